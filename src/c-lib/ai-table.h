@@ -0,0 +1,1060 @@
+/*
+ *  Generated from gs1-format-spec.txt by build-gs1-syntax-dict.pl
+ *
+ *  Do not edit this file directly.
+ *
+ */
+
+static const struct aiEntry ai_table[] = {
+	AI( "00"  , NO_FNC1, DL_PKEY   , N,18,18,csum, __, __, __, __,                "SSCC"                      ),
+	AI( "01"  , NO_FNC1, DL_PKEY   , N,14,14,csum, __, __, __, __,                "GTIN"                      ),
+	AI( "02"  , NO_FNC1, NO_DL_PKEY, N,14,14,csum, __, __, __, __,                "CONTENT"                   ),
+	AI( "10"  , FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "BATCH/LOT"                 ),
+	AI( "11"  , NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "PROD DATE"                 ),
+	AI( "12"  , NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "DUE DATE"                  ),
+	AI( "13"  , NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "PACK DATE"                 ),
+	AI( "15"  , NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "BEST BEFORE or BEST BY"    ),
+	AI( "16"  , NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "SELL BY"                   ),
+	AI( "17"  , NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "USE BY or EXPIRY"          ),
+	AI( "20"  , NO_FNC1, NO_DL_PKEY, N,2,2,_, __, __, __, __,                     "VARIANT"                   ),
+	AI( "21"  , FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "SERIAL"                    ),
+	AI( "22"  , FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "CPV"                       ),
+	AI( "235" , FNC1   , NO_DL_PKEY, X,1,28,_, __, __, __, __,                    "TPX"                       ),
+	AI( "240" , FNC1   , NO_DL_PKEY, X,1,30,_, __, __, __, __,                    "ADDITIONAL ID"             ),
+	AI( "241" , FNC1   , NO_DL_PKEY, X,1,30,_, __, __, __, __,                    "CUST. PART NO."            ),
+	AI( "242" , FNC1   , NO_DL_PKEY, N,1,6,_, __, __, __, __,                     "MTO VARIANT"               ),
+	AI( "243" , FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "PCN"                       ),
+	AI( "250" , FNC1   , NO_DL_PKEY, X,1,30,_, __, __, __, __,                    "SECONDARY SERIAL"          ),
+	AI( "251" , FNC1   , NO_DL_PKEY, X,1,30,_, __, __, __, __,                    "REF. TO SOURCE"            ),
+	AI( "253" , FNC1   , DL_PKEY   , N,13,13,csum, X,0,17,_, __, __, __,          "GDTI"                      ),
+	AI( "254" , FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "GLN EXTENSION COMPONENT"   ),
+	AI( "255" , FNC1   , DL_PKEY   , N,13,13,csum, N,0,12,_, __, __, __,          "GCN"                       ),
+	AI( "30"  , FNC1   , NO_DL_PKEY, N,1,8,_, __, __, __, __,                     "VAR. COUNT"                ),
+	AI( "3100", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (kg)"           ),
+	AI( "3101", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (kg)"           ),
+	AI( "3102", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (kg)"           ),
+	AI( "3103", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (kg)"           ),
+	AI( "3104", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (kg)"           ),
+	AI( "3105", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (kg)"           ),
+	AI( "3110", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (m)"                ),
+	AI( "3111", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (m)"                ),
+	AI( "3112", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (m)"                ),
+	AI( "3113", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (m)"                ),
+	AI( "3114", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (m)"                ),
+	AI( "3115", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (m)"                ),
+	AI( "3120", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (m)"                 ),
+	AI( "3121", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (m)"                 ),
+	AI( "3122", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (m)"                 ),
+	AI( "3123", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (m)"                 ),
+	AI( "3124", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (m)"                 ),
+	AI( "3125", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (m)"                 ),
+	AI( "3130", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (m)"                ),
+	AI( "3131", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (m)"                ),
+	AI( "3132", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (m)"                ),
+	AI( "3133", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (m)"                ),
+	AI( "3134", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (m)"                ),
+	AI( "3135", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (m)"                ),
+	AI( "3140", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (m^2)"                ),
+	AI( "3141", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (m^2)"                ),
+	AI( "3142", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (m^2)"                ),
+	AI( "3143", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (m^2)"                ),
+	AI( "3144", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (m^2)"                ),
+	AI( "3145", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (m^2)"                ),
+	AI( "3150", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (l)"            ),
+	AI( "3151", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (l)"            ),
+	AI( "3152", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (l)"            ),
+	AI( "3153", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (l)"            ),
+	AI( "3154", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (l)"            ),
+	AI( "3155", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (l)"            ),
+	AI( "3160", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (m^3)"          ),
+	AI( "3161", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (m^3)"          ),
+	AI( "3162", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (m^3)"          ),
+	AI( "3163", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (m^3)"          ),
+	AI( "3164", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (m^3)"          ),
+	AI( "3165", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (m^3)"          ),
+	AI( "3200", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (lb)"           ),
+	AI( "3201", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (lb)"           ),
+	AI( "3202", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (lb)"           ),
+	AI( "3203", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (lb)"           ),
+	AI( "3204", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (lb)"           ),
+	AI( "3205", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (lb)"           ),
+	AI( "3210", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (i)"                ),
+	AI( "3211", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (i)"                ),
+	AI( "3212", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (i)"                ),
+	AI( "3213", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (i)"                ),
+	AI( "3214", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (i)"                ),
+	AI( "3215", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (i)"                ),
+	AI( "3220", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (f)"                ),
+	AI( "3221", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (f)"                ),
+	AI( "3222", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (f)"                ),
+	AI( "3223", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (f)"                ),
+	AI( "3224", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (f)"                ),
+	AI( "3225", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (f)"                ),
+	AI( "3230", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (y)"                ),
+	AI( "3231", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (y)"                ),
+	AI( "3232", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (y)"                ),
+	AI( "3233", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (y)"                ),
+	AI( "3234", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (y)"                ),
+	AI( "3235", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (y)"                ),
+	AI( "3240", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (i)"                 ),
+	AI( "3241", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (i)"                 ),
+	AI( "3242", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (i)"                 ),
+	AI( "3243", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (i)"                 ),
+	AI( "3244", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (i)"                 ),
+	AI( "3245", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (i)"                 ),
+	AI( "3250", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (f)"                 ),
+	AI( "3251", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (f)"                 ),
+	AI( "3252", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (f)"                 ),
+	AI( "3253", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (f)"                 ),
+	AI( "3254", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (f)"                 ),
+	AI( "3255", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (f)"                 ),
+	AI( "3260", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (y)"                 ),
+	AI( "3261", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (y)"                 ),
+	AI( "3262", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (y)"                 ),
+	AI( "3263", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (y)"                 ),
+	AI( "3264", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (y)"                 ),
+	AI( "3265", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (y)"                 ),
+	AI( "3270", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (i)"                ),
+	AI( "3271", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (i)"                ),
+	AI( "3272", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (i)"                ),
+	AI( "3273", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (i)"                ),
+	AI( "3274", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (i)"                ),
+	AI( "3275", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (i)"                ),
+	AI( "3280", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (f)"                ),
+	AI( "3281", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (f)"                ),
+	AI( "3282", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (f)"                ),
+	AI( "3283", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (f)"                ),
+	AI( "3284", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (f)"                ),
+	AI( "3285", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (f)"                ),
+	AI( "3290", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (y)"                ),
+	AI( "3291", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (y)"                ),
+	AI( "3292", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (y)"                ),
+	AI( "3293", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (y)"                ),
+	AI( "3294", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (y)"                ),
+	AI( "3295", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (y)"                ),
+	AI( "3300", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (kg)"         ),
+	AI( "3301", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (kg)"         ),
+	AI( "3302", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (kg)"         ),
+	AI( "3303", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (kg)"         ),
+	AI( "3304", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (kg)"         ),
+	AI( "3305", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (kg)"         ),
+	AI( "3310", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (m), log"           ),
+	AI( "3311", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (m), log"           ),
+	AI( "3312", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (m), log"           ),
+	AI( "3313", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (m), log"           ),
+	AI( "3314", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (m), log"           ),
+	AI( "3315", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (m), log"           ),
+	AI( "3320", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (m), log"            ),
+	AI( "3321", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (m), log"            ),
+	AI( "3322", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (m), log"            ),
+	AI( "3323", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (m), log"            ),
+	AI( "3324", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (m), log"            ),
+	AI( "3325", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (m), log"            ),
+	AI( "3330", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (m), log"           ),
+	AI( "3331", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (m), log"           ),
+	AI( "3332", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (m), log"           ),
+	AI( "3333", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (m), log"           ),
+	AI( "3334", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (m), log"           ),
+	AI( "3335", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (m), log"           ),
+	AI( "3340", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (m^2), log"           ),
+	AI( "3341", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (m^2), log"           ),
+	AI( "3342", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (m^2), log"           ),
+	AI( "3343", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (m^2), log"           ),
+	AI( "3344", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (m^2), log"           ),
+	AI( "3345", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (m^2), log"           ),
+	AI( "3350", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (l), log"           ),
+	AI( "3351", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (l), log"           ),
+	AI( "3352", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (l), log"           ),
+	AI( "3353", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (l), log"           ),
+	AI( "3354", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (l), log"           ),
+	AI( "3355", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (l), log"           ),
+	AI( "3360", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (m^3), log"         ),
+	AI( "3361", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (m^3), log"         ),
+	AI( "3362", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (m^3), log"         ),
+	AI( "3363", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (m^3), log"         ),
+	AI( "3364", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (m^3), log"         ),
+	AI( "3365", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (m^3), log"         ),
+	AI( "3370", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "KG PER m^2"                ),
+	AI( "3371", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "KG PER m^2"                ),
+	AI( "3372", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "KG PER m^2"                ),
+	AI( "3373", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "KG PER m^2"                ),
+	AI( "3374", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "KG PER m^2"                ),
+	AI( "3375", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "KG PER m^2"                ),
+	AI( "3400", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (lb)"         ),
+	AI( "3401", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (lb)"         ),
+	AI( "3402", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (lb)"         ),
+	AI( "3403", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (lb)"         ),
+	AI( "3404", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (lb)"         ),
+	AI( "3405", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (lb)"         ),
+	AI( "3410", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (i), log"           ),
+	AI( "3411", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (i), log"           ),
+	AI( "3412", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (i), log"           ),
+	AI( "3413", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (i), log"           ),
+	AI( "3414", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (i), log"           ),
+	AI( "3415", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (i), log"           ),
+	AI( "3420", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (f), log"           ),
+	AI( "3421", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (f), log"           ),
+	AI( "3422", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (f), log"           ),
+	AI( "3423", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (f), log"           ),
+	AI( "3424", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (f), log"           ),
+	AI( "3425", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (f), log"           ),
+	AI( "3430", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (y), log"           ),
+	AI( "3431", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (y), log"           ),
+	AI( "3432", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (y), log"           ),
+	AI( "3433", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (y), log"           ),
+	AI( "3434", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (y), log"           ),
+	AI( "3435", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "LENGTH (y), log"           ),
+	AI( "3440", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (i), log"            ),
+	AI( "3441", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (i), log"            ),
+	AI( "3442", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (i), log"            ),
+	AI( "3443", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (i), log"            ),
+	AI( "3444", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (i), log"            ),
+	AI( "3445", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (i), log"            ),
+	AI( "3450", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (f), log"            ),
+	AI( "3451", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (f), log"            ),
+	AI( "3452", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (f), log"            ),
+	AI( "3453", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (f), log"            ),
+	AI( "3454", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (f), log"            ),
+	AI( "3455", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (f), log"            ),
+	AI( "3460", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (y), log"            ),
+	AI( "3461", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (y), log"            ),
+	AI( "3462", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (y), log"            ),
+	AI( "3463", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (y), log"            ),
+	AI( "3464", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (y), log"            ),
+	AI( "3465", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "WIDTH (y), log"            ),
+	AI( "3470", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (i), log"           ),
+	AI( "3471", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (i), log"           ),
+	AI( "3472", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (i), log"           ),
+	AI( "3473", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (i), log"           ),
+	AI( "3474", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (i), log"           ),
+	AI( "3475", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (i), log"           ),
+	AI( "3480", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (f), log"           ),
+	AI( "3481", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (f), log"           ),
+	AI( "3482", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (f), log"           ),
+	AI( "3483", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (f), log"           ),
+	AI( "3484", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (f), log"           ),
+	AI( "3485", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (f), log"           ),
+	AI( "3490", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (y), log"           ),
+	AI( "3491", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (y), log"           ),
+	AI( "3492", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (y), log"           ),
+	AI( "3493", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (y), log"           ),
+	AI( "3494", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (y), log"           ),
+	AI( "3495", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "HEIGHT (y), log"           ),
+	AI( "3500", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (i^2)"                ),
+	AI( "3501", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (i^2)"                ),
+	AI( "3502", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (i^2)"                ),
+	AI( "3503", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (i^2)"                ),
+	AI( "3504", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (i^2)"                ),
+	AI( "3505", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (i^2)"                ),
+	AI( "3510", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (f^2)"                ),
+	AI( "3511", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (f^2)"                ),
+	AI( "3512", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (f^2)"                ),
+	AI( "3513", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (f^2)"                ),
+	AI( "3514", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (f^2)"                ),
+	AI( "3515", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (f^2)"                ),
+	AI( "3520", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (y^2)"                ),
+	AI( "3521", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (y^2)"                ),
+	AI( "3522", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (y^2)"                ),
+	AI( "3523", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (y^2)"                ),
+	AI( "3524", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (y^2)"                ),
+	AI( "3525", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (y^2)"                ),
+	AI( "3530", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (i^2), log"           ),
+	AI( "3531", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (i^2), log"           ),
+	AI( "3532", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (i^2), log"           ),
+	AI( "3533", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (i^2), log"           ),
+	AI( "3534", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (i^2), log"           ),
+	AI( "3535", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (i^2), log"           ),
+	AI( "3540", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (f^2), log"           ),
+	AI( "3541", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (f^2), log"           ),
+	AI( "3542", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (f^2), log"           ),
+	AI( "3543", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (f^2), log"           ),
+	AI( "3544", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (f^2), log"           ),
+	AI( "3545", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (f^2), log"           ),
+	AI( "3550", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (y^2), log"           ),
+	AI( "3551", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (y^2), log"           ),
+	AI( "3552", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (y^2), log"           ),
+	AI( "3553", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (y^2), log"           ),
+	AI( "3554", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (y^2), log"           ),
+	AI( "3555", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "AREA (y^2), log"           ),
+	AI( "3560", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (t)"            ),
+	AI( "3561", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (t)"            ),
+	AI( "3562", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (t)"            ),
+	AI( "3563", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (t)"            ),
+	AI( "3564", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (t)"            ),
+	AI( "3565", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET WEIGHT (t)"            ),
+	AI( "3570", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (oz)"           ),
+	AI( "3571", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (oz)"           ),
+	AI( "3572", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (oz)"           ),
+	AI( "3573", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (oz)"           ),
+	AI( "3574", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (oz)"           ),
+	AI( "3575", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (oz)"           ),
+	AI( "3600", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (q)"            ),
+	AI( "3601", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (q)"            ),
+	AI( "3602", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (q)"            ),
+	AI( "3603", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (q)"            ),
+	AI( "3604", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (q)"            ),
+	AI( "3605", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (q)"            ),
+	AI( "3610", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (g)"            ),
+	AI( "3611", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (g)"            ),
+	AI( "3612", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (g)"            ),
+	AI( "3613", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (g)"            ),
+	AI( "3614", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (g)"            ),
+	AI( "3615", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "NET VOLUME (g)"            ),
+	AI( "3620", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (q), log"           ),
+	AI( "3621", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (q), log"           ),
+	AI( "3622", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (q), log"           ),
+	AI( "3623", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (q), log"           ),
+	AI( "3624", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (q), log"           ),
+	AI( "3625", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (q), log"           ),
+	AI( "3630", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (g), log"           ),
+	AI( "3631", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (g), log"           ),
+	AI( "3632", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (g), log"           ),
+	AI( "3633", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (g), log"           ),
+	AI( "3634", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (g), log"           ),
+	AI( "3635", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (g), log"           ),
+	AI( "3640", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (i^3)"              ),
+	AI( "3641", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (i^3)"              ),
+	AI( "3642", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (i^3)"              ),
+	AI( "3643", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (i^3)"              ),
+	AI( "3644", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (i^3)"              ),
+	AI( "3645", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (i^3)"              ),
+	AI( "3650", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (f^3)"              ),
+	AI( "3651", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (f^3)"              ),
+	AI( "3652", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (f^3)"              ),
+	AI( "3653", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (f^3)"              ),
+	AI( "3654", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (f^3)"              ),
+	AI( "3655", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (f^3)"              ),
+	AI( "3660", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (y^3)"              ),
+	AI( "3661", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (y^3)"              ),
+	AI( "3662", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (y^3)"              ),
+	AI( "3663", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (y^3)"              ),
+	AI( "3664", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (y^3)"              ),
+	AI( "3665", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (y^3)"              ),
+	AI( "3670", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (i^3), log"         ),
+	AI( "3671", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (i^3), log"         ),
+	AI( "3672", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (i^3), log"         ),
+	AI( "3673", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (i^3), log"         ),
+	AI( "3674", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (i^3), log"         ),
+	AI( "3675", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (i^3), log"         ),
+	AI( "3680", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (f^3), log"         ),
+	AI( "3681", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (f^3), log"         ),
+	AI( "3682", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (f^3), log"         ),
+	AI( "3683", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (f^3), log"         ),
+	AI( "3684", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (f^3), log"         ),
+	AI( "3685", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (f^3), log"         ),
+	AI( "3690", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (y^3), log"         ),
+	AI( "3691", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (y^3), log"         ),
+	AI( "3692", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (y^3), log"         ),
+	AI( "3693", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (y^3), log"         ),
+	AI( "3694", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (y^3), log"         ),
+	AI( "3695", NO_FNC1, NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "VOLUME (y^3), log"         ),
+	AI( "37"  , FNC1   , NO_DL_PKEY, N,1,8,_, __, __, __, __,                     "COUNT"                     ),
+	AI( "3900", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
+	AI( "3901", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
+	AI( "3902", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
+	AI( "3903", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
+	AI( "3904", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
+	AI( "3905", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
+	AI( "3906", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
+	AI( "3907", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
+	AI( "3908", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
+	AI( "3909", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
+	AI( "3910", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
+	AI( "3911", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
+	AI( "3912", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
+	AI( "3913", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
+	AI( "3914", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
+	AI( "3915", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
+	AI( "3916", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
+	AI( "3917", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
+	AI( "3918", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
+	AI( "3919", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
+	AI( "3920", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "PRICE"                     ),
+	AI( "3921", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "PRICE"                     ),
+	AI( "3922", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "PRICE"                     ),
+	AI( "3923", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "PRICE"                     ),
+	AI( "3924", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "PRICE"                     ),
+	AI( "3925", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "PRICE"                     ),
+	AI( "3926", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "PRICE"                     ),
+	AI( "3927", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "PRICE"                     ),
+	AI( "3928", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "PRICE"                     ),
+	AI( "3929", FNC1   , NO_DL_PKEY, N,1,15,_, __, __, __, __,                    "PRICE"                     ),
+	AI( "3930", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
+	AI( "3931", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
+	AI( "3932", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
+	AI( "3933", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
+	AI( "3934", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
+	AI( "3935", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
+	AI( "3936", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
+	AI( "3937", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
+	AI( "3938", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
+	AI( "3939", FNC1   , NO_DL_PKEY, N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
+	AI( "3940", FNC1   , NO_DL_PKEY, N,4,4,_, __, __, __, __,                     "PRCNT OFF"                 ),
+	AI( "3941", FNC1   , NO_DL_PKEY, N,4,4,_, __, __, __, __,                     "PRCNT OFF"                 ),
+	AI( "3942", FNC1   , NO_DL_PKEY, N,4,4,_, __, __, __, __,                     "PRCNT OFF"                 ),
+	AI( "3943", FNC1   , NO_DL_PKEY, N,4,4,_, __, __, __, __,                     "PRCNT OFF"                 ),
+	AI( "3950", FNC1   , NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "PRICE/UoM"                 ),
+	AI( "3951", FNC1   , NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "PRICE/UoM"                 ),
+	AI( "3952", FNC1   , NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "PRICE/UoM"                 ),
+	AI( "3953", FNC1   , NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "PRICE/UoM"                 ),
+	AI( "3954", FNC1   , NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "PRICE/UoM"                 ),
+	AI( "3955", FNC1   , NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "PRICE/UoM"                 ),
+	AI( "400" , FNC1   , NO_DL_PKEY, X,1,30,_, __, __, __, __,                    "ORDER NUMBER"              ),
+	AI( "401" , FNC1   , DL_PKEY   , X,1,30,_, __, __, __, __,                    "GINC"                      ),
+	AI( "402" , FNC1   , DL_PKEY   , N,17,17,csum, __, __, __, __,                "GSIN"                      ),
+	AI( "403" , FNC1   , NO_DL_PKEY, X,1,30,_, __, __, __, __,                    "ROUTE"                     ),
+	AI( "410" , NO_FNC1, NO_DL_PKEY, N,13,13,csum, __, __, __, __,                "SHIP TO LOC"               ),
+	AI( "411" , NO_FNC1, NO_DL_PKEY, N,13,13,csum, __, __, __, __,                "BILL TO"                   ),
+	AI( "412" , NO_FNC1, NO_DL_PKEY, N,13,13,csum, __, __, __, __,                "PURCHASE FROM"             ),
+	AI( "413" , NO_FNC1, NO_DL_PKEY, N,13,13,csum, __, __, __, __,                "SHIP FOR LOC"              ),
+	AI( "414" , NO_FNC1, DL_PKEY   , N,13,13,csum, __, __, __, __,                "LOC NO."                   ),
+	AI( "415" , NO_FNC1, NO_DL_PKEY, N,13,13,csum, __, __, __, __,                "PAY TO"                    ),
+	AI( "416" , NO_FNC1, NO_DL_PKEY, N,13,13,csum, __, __, __, __,                "PROD/SERV LOC"             ),
+	AI( "417" , NO_FNC1, DL_PKEY   , N,13,13,csum, __, __, __, __,                "PARTY"                     ),
+	AI( "420" , FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "SHIP TO POST"              ),
+	AI( "421" , FNC1   , NO_DL_PKEY, N,3,3,_, X,1,9,_, __, __, __,                "SHIP TO POST"              ),
+	AI( "422" , FNC1   , NO_DL_PKEY, N,3,3,_, __, __, __, __,                     "ORIGIN"                    ),
+	AI( "423" , FNC1   , NO_DL_PKEY, N,3,15,_, __, __, __, __,                    "COUNTRY - INITIAL PROCESS" ),
+	AI( "424" , FNC1   , NO_DL_PKEY, N,3,3,_, __, __, __, __,                     "COUNTRY - PROCESS"         ),
+	AI( "425" , FNC1   , NO_DL_PKEY, N,3,15,_, __, __, __, __,                    "COUNTRY - DISASSEMBLY"     ),
+	AI( "426" , FNC1   , NO_DL_PKEY, N,3,3,_, __, __, __, __,                     "COUNTRY - FULL PROCESS"    ),
+	AI( "427" , FNC1   , NO_DL_PKEY, X,1,3,_, __, __, __, __,                     "ORIGIN SUBDIVISION"        ),
+	AI( "4300", FNC1   , NO_DL_PKEY, X,1,35,_, __, __, __, __,                    "SHIP TO COMP"              ),
+	AI( "4301", FNC1   , NO_DL_PKEY, X,1,35,_, __, __, __, __,                    "SHIP TO NAME"              ),
+	AI( "4302", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    "SHIP TO ADD1"              ),
+	AI( "4303", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    "SHIP TO ADD2"              ),
+	AI( "4304", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    "SHIP TO SUB"               ),
+	AI( "4305", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    "SHIP TO LOC"               ),
+	AI( "4306", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    "SHIP TO REG"               ),
+	AI( "4307", FNC1   , NO_DL_PKEY, X,2,2,_, __, __, __, __,                     "SHIP TO COUNTRY"           ),
+	AI( "4308", FNC1   , NO_DL_PKEY, X,1,30,_, __, __, __, __,                    "SHIP TO PHONE"             ),
+	AI( "4310", FNC1   , NO_DL_PKEY, X,1,35,_, __, __, __, __,                    "RTN TO COMP"               ),
+	AI( "4311", FNC1   , NO_DL_PKEY, X,1,35,_, __, __, __, __,                    "RTN TO NAME"               ),
+	AI( "4312", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    "RTN TO ADD1"               ),
+	AI( "4313", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    "RTN TO ADD2"               ),
+	AI( "4314", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    "RTN TO SUB"                ),
+	AI( "4315", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    "RTN TO LOC"                ),
+	AI( "4316", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    "RTN TO REG"                ),
+	AI( "4317", FNC1   , NO_DL_PKEY, X,2,2,_, __, __, __, __,                     "RTN TO COUNTRY"            ),
+	AI( "4318", FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "RTN TO POST"               ),
+	AI( "4319", FNC1   , NO_DL_PKEY, X,1,30,_, __, __, __, __,                    "RTN TO PHONE"              ),
+	AI( "4320", FNC1   , NO_DL_PKEY, X,1,35,_, __, __, __, __,                    "SRV DESCRIPTION"           ),
+	AI( "4321", FNC1   , NO_DL_PKEY, N,1,1,_, __, __, __, __,                     "DANGEROUS GOODS"           ),
+	AI( "4322", FNC1   , NO_DL_PKEY, N,1,1,_, __, __, __, __,                     "AUTH LEAVE"                ),
+	AI( "4323", FNC1   , NO_DL_PKEY, N,1,1,_, __, __, __, __,                     "SIG REQUIRED"              ),
+	AI( "4324", FNC1   , NO_DL_PKEY, N,6,6,_, N,4,4,_, __, __, __,                "NBEF DEL DT."              ),
+	AI( "4325", FNC1   , NO_DL_PKEY, N,6,6,_, N,4,4,_, __, __, __,                "NAFT DEL DT."              ),
+	AI( "4326", FNC1   , NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "REL DATE"                  ),
+	AI( "7001", FNC1   , NO_DL_PKEY, N,13,13,_, __, __, __, __,                   "NSN"                       ),
+	AI( "7002", FNC1   , NO_DL_PKEY, X,1,30,_, __, __, __, __,                    "MEAT CUT"                  ),
+	AI( "7003", FNC1   , NO_DL_PKEY, N,6,6,_, N,4,4,_, __, __, __,                "EXPIRY TIME"               ),
+	AI( "7004", FNC1   , NO_DL_PKEY, N,1,4,_, __, __, __, __,                     "ACTIVE POTENCY"            ),
+	AI( "7005", FNC1   , NO_DL_PKEY, X,1,12,_, __, __, __, __,                    "CATCH AREA"                ),
+	AI( "7006", FNC1   , NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "FIRST FREEZE DATE"         ),
+	AI( "7007", FNC1   , NO_DL_PKEY, N,6,6,_, N,0,6,_, __, __, __,                "HARVEST DATE"              ),
+	AI( "7008", FNC1   , NO_DL_PKEY, X,1,3,_, __, __, __, __,                     "AQUATIC SPECIES"           ),
+	AI( "7009", FNC1   , NO_DL_PKEY, X,1,10,_, __, __, __, __,                    "FISHING GEAR TYPE"         ),
+	AI( "7010", FNC1   , NO_DL_PKEY, X,1,2,_, __, __, __, __,                     "PROD METHOD"               ),
+	AI( "7020", FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "REFURB LOT"                ),
+	AI( "7021", FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "FUNC STAT"                 ),
+	AI( "7022", FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "REV STAT"                  ),
+	AI( "7023", FNC1   , NO_DL_PKEY, X,1,30,_, __, __, __, __,                    "GIAI - ASSEMBLY"           ),
+	AI( "7030", FNC1   , NO_DL_PKEY, N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
+	AI( "7031", FNC1   , NO_DL_PKEY, N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
+	AI( "7032", FNC1   , NO_DL_PKEY, N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
+	AI( "7033", FNC1   , NO_DL_PKEY, N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
+	AI( "7034", FNC1   , NO_DL_PKEY, N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
+	AI( "7035", FNC1   , NO_DL_PKEY, N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
+	AI( "7036", FNC1   , NO_DL_PKEY, N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
+	AI( "7037", FNC1   , NO_DL_PKEY, N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
+	AI( "7038", FNC1   , NO_DL_PKEY, N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
+	AI( "7039", FNC1   , NO_DL_PKEY, N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
+	AI( "7040", FNC1   , NO_DL_PKEY, N,1,1,_, X,1,1,_, X,1,1,_, X,1,1,_, __,      "UIC+EXT"                   ),
+	AI( "710" , FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "NHRN PZN"                  ),
+	AI( "711" , FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "NHRN CIP"                  ),
+	AI( "712" , FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "NHRN CN"                   ),
+	AI( "713" , FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "NHRN DRN"                  ),
+	AI( "714" , FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "NHRN AIM"                  ),
+	AI( "7230", FNC1   , NO_DL_PKEY, X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
+	AI( "7231", FNC1   , NO_DL_PKEY, X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
+	AI( "7232", FNC1   , NO_DL_PKEY, X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
+	AI( "7233", FNC1   , NO_DL_PKEY, X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
+	AI( "7234", FNC1   , NO_DL_PKEY, X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
+	AI( "7235", FNC1   , NO_DL_PKEY, X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
+	AI( "7236", FNC1   , NO_DL_PKEY, X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
+	AI( "7237", FNC1   , NO_DL_PKEY, X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
+	AI( "7238", FNC1   , NO_DL_PKEY, X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
+	AI( "7239", FNC1   , NO_DL_PKEY, X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
+	AI( "7240", FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "PROTOCOL"                  ),
+	AI( "8001", FNC1   , NO_DL_PKEY, N,4,4,_, N,5,5,_, N,3,3,_, N,1,1,_, N,1,1,_, "DIMENSIONS"                ),
+	AI( "8002", FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "CMT NO."                   ),
+	AI( "8003", FNC1   , DL_PKEY   , N,1,1,_, N,13,13,csum, X,0,16,_, __, __,     "GRAI"                      ),
+	AI( "8004", FNC1   , DL_PKEY   , X,1,30,_, __, __, __, __,                    "GIAI"                      ),
+	AI( "8005", FNC1   , NO_DL_PKEY, N,6,6,_, __, __, __, __,                     "PRICE PER UNIT"            ),
+	AI( "8006", FNC1   , DL_PKEY   , N,14,14,csum, N,4,4,_, __, __, __,           "ITIP"                      ),
+	AI( "8007", FNC1   , NO_DL_PKEY, X,1,34,_, __, __, __, __,                    "IBAN"                      ),
+	AI( "8008", FNC1   , NO_DL_PKEY, N,8,8,_, N,0,4,_, __, __, __,                "PROD TIME"                 ),
+	AI( "8009", FNC1   , NO_DL_PKEY, X,1,50,_, __, __, __, __,                    "OPTSEN"                    ),
+	AI( "8010", FNC1   , DL_PKEY   , C,1,30,_, __, __, __, __,                    "CPID"                      ),
+	AI( "8011", FNC1   , NO_DL_PKEY, N,1,12,_, __, __, __, __,                    "CPID SERIAL"               ),
+	AI( "8012", FNC1   , NO_DL_PKEY, X,1,20,_, __, __, __, __,                    "VERSION"                   ),
+	AI( "8013", FNC1   , DL_PKEY   , X,1,25,csumalpha, __, __, __, __,            "GMN"                       ),
+	AI( "8017", FNC1   , DL_PKEY   , N,18,18,csum, __, __, __, __,                "GSRN - PROVIDER"           ),
+	AI( "8018", FNC1   , DL_PKEY   , N,18,18,csum, __, __, __, __,                "GSRN - RECIPIENT"          ),
+	AI( "8019", FNC1   , NO_DL_PKEY, N,1,10,_, __, __, __, __,                    "SRIN"                      ),
+	AI( "8020", FNC1   , NO_DL_PKEY, X,1,25,_, __, __, __, __,                    "REF NO."                   ),
+	AI( "8026", FNC1   , NO_DL_PKEY, N,14,14,csum, N,4,4,_, __, __, __,           "ITIP CONTENT"              ),
+	AI( "8110", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    ""                          ),
+	AI( "8111", FNC1   , NO_DL_PKEY, N,4,4,_, __, __, __, __,                     "POINTS"                    ),
+	AI( "8112", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    ""                          ),
+	AI( "8200", FNC1   , NO_DL_PKEY, X,1,70,_, __, __, __, __,                    "PRODUCT URL"               ),
+	AI( "90"  , FNC1   , NO_DL_PKEY, X,1,30,_, __, __, __, __,                    "INTERNAL"                  ),
+	AI( "91"  , FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
+	AI( "92"  , FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
+	AI( "93"  , FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
+	AI( "94"  , FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
+	AI( "95"  , FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
+	AI( "96"  , FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
+	AI( "97"  , FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
+	AI( "98"  , FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
+	AI( "99"  , FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
+};
+
+static const uint16_t ai_index[AI_INDEX_KEYS+1] = {
+	  0,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+	  3,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+	  3,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+	  3,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+	  3,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+	  3,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+	  3,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+	  3,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+	  3,   4,   4,   4,   4,   4,   4,   4,   4,   4,
+	  4,   5,   5,   5,   5,   5,   5,   5,   5,   5,
+	  5,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+	  6,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+	  7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+	  7,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+	  8,   9,   9,   9,   9,   9,   9,   9,   9,   9,
+	  9,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+	 10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+	 10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+	 10,  11,  11,  11,  11,  11,  11,  11,  11,  11,
+	 11,  12,  12,  12,  12,  12,  12,  12,  12,  12,
+	 12,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  14,  14,  14,  14,
+	 14,  15,  16,  17,  18,  18,  18,  18,  18,  18,
+	 18,  19,  20,  20,  21,  22,  23,  23,  23,  23,
+	 23,  23,  23,  23,  23,  23,  23,  23,  23,  23,
+	 23,  23,  23,  23,  23,  23,  23,  23,  23,  23,
+	 23,  23,  23,  23,  23,  23,  23,  23,  23,  23,
+	 23,  23,  23,  23,  23,  23,  23,  23,  23,  23,
+	 23,  24,  24,  24,  24,  24,  24,  24,  24,  24,
+	 24,  30,  36,  42,  48,  54,  60,  66,  66,  66,
+	 66,  72,  78,  84,  90,  96, 102, 108, 114, 120,
+	126, 132, 138, 144, 150, 156, 162, 168, 174, 174,
+	174, 180, 186, 192, 198, 204, 210, 216, 222, 228,
+	234, 240, 246, 252, 258, 264, 270, 276, 282, 282,
+	282, 288, 294, 300, 306, 312, 318, 324, 330, 336,
+	342, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+	343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+	343, 353, 363, 373, 383, 387, 393, 393, 393, 393,
+	393, 394, 395, 396, 397, 397, 397, 397, 397, 397,
+	397, 398, 399, 400, 401, 402, 403, 404, 405, 405,
+	405, 406, 407, 408, 409, 410, 411, 412, 413, 413,
+	413, 422, 432, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 448, 449, 453, 463, 464, 464, 464, 464, 464,
+	464, 465, 466, 467, 468, 469, 469, 469, 469, 469,
+	469, 469, 469, 469, 479, 480, 480, 480, 480, 480,
+	480, 480, 480, 480, 480, 480, 480, 480, 480, 480,
+	480, 480, 480, 480, 480, 480, 480, 480, 480, 480,
+	480, 480, 480, 480, 480, 480, 480, 480, 480, 480,
+	480, 480, 480, 480, 480, 480, 480, 480, 480, 480,
+	480, 480, 480, 480, 480, 480, 480, 480, 480, 480,
+	480, 480, 480, 480, 480, 480, 480, 480, 480, 480,
+	480, 480, 480, 480, 480, 480, 480, 480, 480, 480,
+	480, 489, 496, 498, 498, 498, 498, 498, 498, 498,
+	498, 498, 501, 501, 501, 501, 501, 501, 501, 501,
+	501, 502, 502, 502, 502, 502, 502, 502, 502, 502,
+	502, 502, 502, 502, 502, 502, 502, 502, 502, 502,
+	502, 502, 502, 502, 502, 502, 502, 502, 502, 502,
+	502, 502, 502, 502, 502, 502, 502, 502, 502, 502,
+	502, 502, 502, 502, 502, 502, 502, 502, 502, 502,
+	502, 502, 502, 502, 502, 502, 502, 502, 502, 502,
+	502, 502, 502, 502, 502, 502, 502, 502, 502, 502,
+	502, 502, 502, 502, 502, 502, 502, 502, 502, 502,
+	502, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+	504, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+	505, 506, 506, 506, 506, 506, 506, 506, 506, 506,
+	506, 507, 507, 507, 507, 507, 507, 507, 507, 507,
+	507, 508, 508, 508, 508, 508, 508, 508, 508, 508,
+	508, 509, 509, 509, 509, 509, 509, 509, 509, 509,
+	509, 510, 510, 510, 510, 510, 510, 510, 510, 510,
+	510, 511, 511, 511, 511, 511, 511, 511, 511, 511,
+	511, 512, 512, 512, 512, 512, 512, 512, 512, 512,
+	512,
+};
+
+static const struct aiAssoc ai_assoc[] = {
+	{ "00"  ,  0, 0x00000000, { 0x00000000, 0x00000000 } },
+	{ "01"  ,  1, 0x00000064, { 0x00000000, 0x00000000 } },	// ex=02,255,37
+	{ "02"  ,  2, 0x00000002, { 0x00000040, 0x00000000 } },	// req=37 ex=01
+	{ "10"  , NO_ASSOC_BIT, 0x00000000, { 0x00004206, 0x00000000 } },	// req=01,02,8006,8026
+	{ "11"  , NO_ASSOC_BIT, 0x00000000, { 0x00004206, 0x00000000 } },	// req=01,02,8006,8026
+	{ "12"  , NO_ASSOC_BIT, 0x00000000, { 0x00004206, 0x00000000 } },	// req=01,02,8006,8026
+	{ "13"  , NO_ASSOC_BIT, 0x00000000, { 0x00004206, 0x00000000 } },	// req=01,02,8006,8026
+	{ "15"  , NO_ASSOC_BIT, 0x00000000, { 0x00004206, 0x00000000 } },	// req=01,02,8006,8026
+	{ "16"  , NO_ASSOC_BIT, 0x00000000, { 0x00004206, 0x00000000 } },	// req=01,02,8006,8026
+	{ "17"  , NO_ASSOC_BIT, 0x00000000, { 0x00004206, 0x00000000 } },	// req=01,02,8006,8026
+	{ "20"  , NO_ASSOC_BIT, 0x00000000, { 0x00004206, 0x00000000 } },	// req=01,02,8006,8026
+	{ "21"  ,  3, 0x00000010, { 0x00000202, 0x00000000 } },	// req=01,8006 ex=235
+	{ "22"  , NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "235" ,  4, 0x00000008, { 0x00000002, 0x00000000 } },	// req=01 ex=21
+	{ "240" , NO_ASSOC_BIT, 0x00000000, { 0x00004206, 0x00000000 } },	// req=01,02,8006,8026
+	{ "241" , NO_ASSOC_BIT, 0x00000000, { 0x00004206, 0x00000000 } },	// req=01,02,8006,8026
+	{ "242" , NO_ASSOC_BIT, 0x00000000, { 0x00004206, 0x00000000 } },	// req=01,02,8006,8026
+	{ "243" , NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "250" , NO_ASSOC_BIT, 0x00000000, { 0x00000202, 0x00000008 } },	// req=01,8006 req=21
+	{ "251" , NO_ASSOC_BIT, 0x00000000, { 0x00000202, 0x00000000 } },	// req=01,8006
+	{ "254" , NO_ASSOC_BIT, 0x00000000, { 0x00000080, 0x00000000 } },	// req=414
+	{ "255" ,  5, 0x00000006, { 0x00000000, 0x00000000 } },	// ex=01,02
+	{ "30"  , NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3100", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3101", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3102", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3103", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3104", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3105", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3110", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3111", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3112", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3113", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3114", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3115", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3120", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3121", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3122", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3123", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3124", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3125", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3130", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3131", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3132", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3133", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3134", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3135", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3140", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3141", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3142", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3143", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3144", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3145", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3150", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3151", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3152", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3153", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3154", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3155", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3160", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3161", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3162", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3163", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3164", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3165", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3200", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3201", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3202", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3203", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3204", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3205", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3210", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3211", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3212", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3213", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3214", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3215", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3220", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3221", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3222", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3223", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3224", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3225", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3230", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3231", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3232", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3233", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3234", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3235", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3240", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3241", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3242", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3243", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3244", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3245", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3250", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3251", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3252", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3253", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3254", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3255", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3260", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3261", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3262", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3263", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3264", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3265", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3270", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3271", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3272", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3273", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3274", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3275", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3280", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3281", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3282", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3283", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3284", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3285", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3290", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3291", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3292", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3293", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3294", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3295", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3300", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3301", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3302", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3303", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3304", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3305", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3310", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3311", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3312", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3313", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3314", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3315", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3320", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3321", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3322", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3323", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3324", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3325", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3330", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3331", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3332", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3333", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3334", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3335", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3340", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3341", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3342", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3343", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3344", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3345", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3350", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3351", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3352", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3353", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3354", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3355", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3360", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3361", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3362", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3363", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3364", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3365", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3370", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3371", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3372", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3373", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3374", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3375", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3400", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3401", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3402", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3403", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3404", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3405", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3410", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3411", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3412", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3413", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3414", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3415", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3420", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3421", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3422", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3423", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3424", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3425", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3430", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3431", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3432", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3433", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3434", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3435", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3440", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3441", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3442", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3443", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3444", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3445", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3450", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3451", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3452", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3453", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3454", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3455", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3460", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3461", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3462", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3463", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3464", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3465", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3470", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3471", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3472", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3473", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3474", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3475", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3480", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3481", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3482", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3483", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3484", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3485", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3490", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3491", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3492", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3493", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3494", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3495", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3500", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3501", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3502", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3503", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3504", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3505", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3510", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3511", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3512", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3513", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3514", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3515", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3520", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3521", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3522", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3523", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3524", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3525", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3530", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3531", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3532", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3533", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3534", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3535", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3540", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3541", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3542", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3543", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3544", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3545", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3550", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3551", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3552", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3553", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3554", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3555", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3560", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3561", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3562", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3563", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3564", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3565", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3570", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3571", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3572", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3573", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3574", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3575", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3600", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3601", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3602", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3603", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3604", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3605", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3610", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3611", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3612", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3613", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3614", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3615", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3620", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3621", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3622", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3623", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3624", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3625", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3630", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3631", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3632", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3633", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3634", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3635", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3640", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3641", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3642", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3643", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3644", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3645", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3650", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3651", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3652", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3653", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3654", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3655", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3660", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3661", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3662", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3663", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3664", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3665", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3670", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3671", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3672", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3673", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3674", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3675", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3680", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3681", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3682", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3683", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3684", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3685", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3690", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3691", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3692", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3693", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3694", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "3695", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "37"  ,  6, 0x00000000, { 0x00004004, 0x00000000 } },	// req=02,8026
+	{ "3900", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3901", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3902", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3903", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3904", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3905", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3906", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3907", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3908", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3909", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3910", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3911", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3912", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3913", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3914", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3915", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3916", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3917", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3918", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3919", NO_ASSOC_BIT, 0x00000000, { 0x00002020, 0x00000000 } },	// req=8020,255
+	{ "3920", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3921", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3922", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3923", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3924", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3925", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3926", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3927", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3928", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3929", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3930", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3931", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3932", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3933", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3934", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3935", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3936", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3937", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3938", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "3939", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "403" , NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "414" ,  7, 0x00000000, { 0x00000000, 0x00000000 } },
+	{ "415" ,  8, 0x00000000, { 0x00002000, 0x00000000 } },	// req=8020
+	{ "4300", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4301", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4302", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4303", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4304", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4305", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4306", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4307", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4308", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4310", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4311", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4312", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4313", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4314", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4315", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4316", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4317", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4318", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4319", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4320", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4321", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4322", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4323", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4324", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4325", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "4326", NO_ASSOC_BIT, 0x00000000, { 0x00000001, 0x00000000 } },	// req=00
+	{ "7001", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "7002", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "7003", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "7004", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "7005", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "7006", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "7007", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "7008", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "7009", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "7010", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "8001", NO_ASSOC_BIT, 0x00000000, { 0x00000002, 0x00000000 } },	// req=01
+	{ "8005", NO_ASSOC_BIT, 0x00000000, { 0x00000006, 0x00000000 } },	// req=01,02
+	{ "8006",  9, 0x00000006, { 0x00000000, 0x00000000 } },	// ex=01,02
+	{ "8010", 10, 0x00000000, { 0x00000000, 0x00000000 } },
+	{ "8011", NO_ASSOC_BIT, 0x00000000, { 0x00000400, 0x00000000 } },	// req=8010
+	{ "8017", 11, 0x00000000, { 0x00000000, 0x00000000 } },
+	{ "8018", 12, 0x00000000, { 0x00000000, 0x00000000 } },
+	{ "8019", NO_ASSOC_BIT, 0x00000000, { 0x00001800, 0x00000000 } },	// req=8017,8018
+	{ "8020", 13, 0x00000000, { 0x00000100, 0x00000000 } },	// req=415
+	{ "8026", 14, 0x00000000, { 0x00000040, 0x00000000 } },	// req=37
+	{ "8111", NO_ASSOC_BIT, 0x00000000, { 0x00000020, 0x00000000 } },	// req=255
+};
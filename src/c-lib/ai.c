@@ -63,111 +63,145 @@
  */
 
 
+// Value of the two digit AI prefix at the start of the given data, or -1
+static int aiPrefix2(const char *ai) {
+	if (ai[0] < '0' || ai[0] > '9' || ai[1] < '0' || ai[1] > '9')
+		return -1;
+	return (ai[0] - '0') * 10 + ai[1] - '0';
+}
+
+
 /*
  *  AI prefixes that are defined as not requiring termination by an FNC1 character
  *
+ *  Indexed directly by the value of the prefix. Token pasting a leading 1 onto
+ *  the prefix avoids the octal interpretation of "08" and "09".
+ *
  */
-static const char *fixedAIprefixes[] = {
-	"00", "01", "02",
-	"03", "04",
-	"11", "12", "13", "14", "15", "16", "17", "18", "19",
-	"20",
-	// "23",	// No longer defined as fixed length
-	"31", "32", "33", "34", "35", "36",
-	"41"
+#define FP(a) [1##a - 100] = true
+
+static const bool fixedAIprefix[100] = {
+	FP(00), FP(01), FP(02),
+	FP(03), FP(04),
+	FP(11), FP(12), FP(13), FP(14), FP(15), FP(16), FP(17), FP(18), FP(19),
+	FP(20),
+	// FP(23),	// No longer defined as fixed length
+	FP(31), FP(32), FP(33), FP(34), FP(35), FP(36),
+	FP(41)
 };
 
 bool gs1_isFNC1required(const char *ai) {
-
-	size_t i;
-
-	for (i = 0; i < SIZEOF_ARRAY(fixedAIprefixes); i++)
-		if (strncmp(fixedAIprefixes[i], ai, 2) == 0)
-			return false;
-
-	return true;
-
+	int pfx;
+	assert(ai);
+	pfx = aiPrefix2(ai);
+	return pfx < 0 || !fixedAIprefix[pfx];
 }
 
 
 /*
  *  AI prefixes to AI length mapping
  *
+ *  Indexed directly by the value of the prefix, with 0 for an undefined length.
+ *
  */
-
-struct aiPrefixLength {
-	char *aiPrefix;
-	uint8_t length;
-};
-
-#define PL(a, l) {			\
-		.aiPrefix = a,		\
-		.length = l,		\
-}
-
-static const struct aiPrefixLength AIlengthByPrefix[] = {
-	PL( "00", 2  ),
-	PL( "01", 2  ),
-	PL( "02", 2  ),
-	PL( "10", 2  ),
-	PL( "11", 2  ),
-	PL( "12", 2  ),
-	PL( "13", 2  ),
-	PL( "15", 2  ),
-	PL( "16", 2  ),
-	PL( "17", 2  ),
-	PL( "20", 2  ),
-	PL( "21", 2  ),
-	PL( "22", 2  ),
-	PL( "23", 3  ),
-	PL( "24", 3  ),
-	PL( "25", 3  ),
-	PL( "30", 2  ),
-	PL( "31", 4  ),
-	PL( "32", 4  ),
-	PL( "33", 4  ),
-	PL( "34", 4  ),
-	PL( "35", 4  ),
-	PL( "36", 4  ),
-	PL( "37", 2  ),
-	PL( "39", 4  ),
-	PL( "40", 3  ),
-	PL( "41", 3  ),
-	PL( "42", 3  ),
-	PL( "43", 4  ),
-	PL( "70", 4  ),
-	PL( "71", 3  ),
-	PL( "72", 4  ),
-	PL( "80", 4  ),
-	PL( "81", 4  ),
-	PL( "82", 4  ),
-	PL( "90", 2  ),
-	PL( "91", 2  ),
-	PL( "92", 2  ),
-	PL( "93", 2  ),
-	PL( "94", 2  ),
-	PL( "95", 2  ),
-	PL( "96", 2  ),
-	PL( "97", 2  ),
-	PL( "98", 2  ),
-	PL( "99", 2  ),
+#define PL(a, l) [1##a - 100] = l
+
+static const uint8_t AIlengthByPrefix[100] = {
+	PL( 00, 2  ),
+	PL( 01, 2  ),
+	PL( 02, 2  ),
+	PL( 10, 2  ),
+	PL( 11, 2  ),
+	PL( 12, 2  ),
+	PL( 13, 2  ),
+	PL( 15, 2  ),
+	PL( 16, 2  ),
+	PL( 17, 2  ),
+	PL( 20, 2  ),
+	PL( 21, 2  ),
+	PL( 22, 2  ),
+	PL( 23, 3  ),
+	PL( 24, 3  ),
+	PL( 25, 3  ),
+	PL( 30, 2  ),
+	PL( 31, 4  ),
+	PL( 32, 4  ),
+	PL( 33, 4  ),
+	PL( 34, 4  ),
+	PL( 35, 4  ),
+	PL( 36, 4  ),
+	PL( 37, 2  ),
+	PL( 39, 4  ),
+	PL( 40, 3  ),
+	PL( 41, 3  ),
+	PL( 42, 3  ),
+	PL( 43, 4  ),
+	PL( 70, 4  ),
+	PL( 71, 3  ),
+	PL( 72, 4  ),
+	PL( 80, 4  ),
+	PL( 81, 4  ),
+	PL( 82, 4  ),
+	PL( 90, 2  ),
+	PL( 91, 2  ),
+	PL( 92, 2  ),
+	PL( 93, 2  ),
+	PL( 94, 2  ),
+	PL( 95, 2  ),
+	PL( 96, 2  ),
+	PL( 97, 2  ),
+	PL( 98, 2  ),
+	PL( 99, 2  ),
 };
 
 uint8_t gs1_aiLengthByPrefix(const char *ai) {
-	size_t i;
+	int pfx;
 	assert(ai);
-	for (i = 0; i < SIZEOF_ARRAY(AIlengthByPrefix); i++)
-		if (strncmp(AIlengthByPrefix[i].aiPrefix, ai, 2) == 0)
-			return AIlengthByPrefix[i].length;
-	return 0;
+	pfx = aiPrefix2(ai);
+	return pfx < 0 ? 0 : AIlengthByPrefix[pfx];
 }
 
 
 /*
- *  Set of 82 characters valid within type "X" AIs
+ *  Character classes, indexed by character
+ *
+ *  CC_DIGIT:  0123456789
+ *  CC_CSET82: Valid within type "X" AIs, as below
+ *  CC_URI:    Permissible in a URI, including percent:
+ *             ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~:/?#[]@!$&'()*+,;=%
+ *  CC_CSET39: #-/0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ, valid within type "C" AIs
  *
  */
-static const char *cset82 = "!\"%&'()*+,-./0123456789:;<=>?ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz";
+const uint8_t gs1_charClass[256] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x02, 0x0c, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0e, 0x06, 0x0e,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x06, 0x06, 0x02, 0x06, 0x02, 0x06,
+	0x04, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x04, 0x00, 0x04, 0x00, 0x06,
+	0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00,
+};
+
+
+/*
+ *  Set of 82 characters valid within type "X" AIs, indexed by character to
+ *  give one more than the position of the character within the set, or zero
+ *  if the character is not in the set
+ *
+ *  !"%&'()*+,-./0123456789:;<=>?ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz
+ *
+ */
+static const uint8_t cset82Pos[256] = {
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  1,  2,  0,  0,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13,
+	14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+	 0, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44,
+	45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,  0,  0,  0,  0, 56,
+	 0, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+	72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,  0,  0,  0,  0,  0,
+};
 
 
 /*
@@ -192,81 +226,77 @@ static const uint16_t primes[] = {
 };
 
 
-/* "Linter" functions
- *
- * Used to validate AI components
+/*
+ *  Record a validation failure for the AI, at the given offset within its value
  *
  */
+static bool fail_ai(gs1_encoder *ctx, const struct aiEntry *entry, const int code, const int offset) {
+	DEBUG_PRINT(" failed\n");
+	gs1_setError(ctx, code, entry->ai, strlen(entry->ai), offset);
+	return false;
+}
 
-static bool lint_cset82(gs1_encoder *ctx, const struct aiEntry *entry, char *val) {
-	DEBUG_PRINT("      cset82...");
-	if (strspn(val, cset82) != strlen(val)) {
-		sprintf(ctx->errMsg, "AI (%s): Incorrect CSET 82 character", entry->ai);
-		ctx->errFlag = true;
-		return false;
-	}
-	DEBUG_PRINT(" success\n");
-	return true;
+static const int csetErrors[cset_C+1] = {
+	[cset_X] = gs1_encoder_eAI_CSET82,
+	[cset_N] = gs1_encoder_eAI_NON_DIGIT,
+	[cset_C] = gs1_encoder_eAI_CSET39,
+};
+
+static bool fail_csumalpha(gs1_encoder *ctx, const struct aiEntry *entry, const size_t len, const int offset) {
+	if (len < 2)
+		return fail_ai(ctx, entry, gs1_encoder_eAI_CSUMALPHA_TOO_SHORT, offset);
+	if (len > SIZEOF_ARRAY(primes))
+		return fail_ai(ctx, entry, gs1_encoder_eAI_CSUMALPHA_TOO_LONG, offset);
+	return fail_ai(ctx, entry, gs1_encoder_eAI_CSUMALPHA_CHECK, offset + (int)len - 2);
 }
 
 
-static bool lint_csetNumeric(gs1_encoder *ctx, const struct aiEntry *entry, char *val) {
-	DEBUG_PRINT("      csetNumeric...");
-	if (!gs1_allDigits((uint8_t*)val, 0)) {
-		sprintf(ctx->errMsg, "AI (%s): Illegal non-digit character", entry->ai);
-		ctx->errFlag = true;
-		return false;
-	}
-	DEBUG_PRINT(" success\n");
-	return true;
+// Alpha check characters for a sum of weighted character positions
+static bool csumalphaMatches(const char *chk, uint32_t sum) {
+	sum %= 1021;
+	return chk[0] == cset32[sum >> 5] && chk[1] == cset32[sum & 31];
 }
 
 
-static bool lint_csum(gs1_encoder *ctx, const struct aiEntry *entry, char *val) {
+/* "Linter" functions
+ *
+ * Used to validate AI components in place, given their length and their
+ * offset within the AI value
+ *
+ */
+
+static bool lint_csum(gs1_encoder *ctx, const struct aiEntry *entry, const char *val, const size_t len, const int offset) {
+
+	int cd;
+
 	DEBUG_PRINT("      csum...");
-	if (!gs1_validateParity((uint8_t*)val)) {
-		DEBUG_PRINT(" failed\n");
-		sprintf(ctx->errMsg, "AI (%s): Incorrect check digit", entry->ai);
-		ctx->errFlag = true;
-		return false;
-	};
+	if (len == 0 || (cd = gs1_checkDigit((const uint8_t*)val, len - 1)) < 0 || cd + '0' != val[len - 1])
+		return fail_ai(ctx, entry, gs1_encoder_eAI_CHECK_DIGIT, offset + (int)len - 1);
 	DEBUG_PRINT(" success\n");
 	return true;
+
 }
 
-static bool lint_csumalpha(gs1_encoder *ctx, const struct aiEntry *entry, char *val) {
+static bool lint_csumalpha(gs1_encoder *ctx, const struct aiEntry *entry, const char *val, const size_t len, const int offset) {
+
 	size_t i;
 	uint32_t sum = 0;
-	size_t len = strlen(val);
-	const uint16_t *p;
+	const uint16_t *w;
 
 	DEBUG_PRINT("      csumalpha...");
-	if (len < 2) {
-		sprintf(ctx->errMsg, "AI (%s): Alphanumeric string is too short to check", entry->ai);
-		goto fail;
-	}
-	if (len > SIZEOF_ARRAY(primes)) {
-		sprintf(ctx->errMsg, "AI (%s): Alphanumeric string is too long to check", entry->ai);
-		goto fail;
-	}
-
-	p = primes + len - 3;
-	for (i = 0; i < len - 2; i++)
-		sum += (uint32_t)((strchr(cset82, val[i]) - cset82) * *p--);
-	sum %= 1021;
-	if (val[i] != cset32[sum >> 5] || val[i+1] != cset32[sum & 31]) {
-		sprintf(ctx->errMsg, "AI (%s): Bad alphanumeric check characters", entry->ai);
-		goto fail;
+	if (len < 2 || len > SIZEOF_ARRAY(primes))
+		return fail_csumalpha(ctx, entry, len, offset);
+	w = primes + len - 3;
+	for (i = 0; i < len - 2; i++) {
+		if (!cset82Pos[(uint8_t)val[i]])
+			return fail_csumalpha(ctx, entry, len, offset);
+		sum += (uint32_t)(cset82Pos[(uint8_t)val[i]] - 1) * *w--;
 	}
-
+	if (!csumalphaMatches(val + i, sum))
+		return fail_csumalpha(ctx, entry, len, offset);
 	DEBUG_PRINT(" success\n");
 	return true;
 
-fail:
-	DEBUG_PRINT(" failed\n");
-	ctx->errFlag = true;
-	return false;
-
 }
 
 
@@ -274,549 +304,190 @@ fail:
 #define NO_FNC1 false
 
 
-#define AI_VA(a, f, c1,mn1,mx1,l01, c2,mn2,mx2,l02, c3,mn3,mx3,l03, c4,mn4,mx4,l04, c5,mn5,mx5,l05, t) {	\
+#define DL_PKEY true
+#define NO_DL_PKEY false
+
+
+#define AI_VA(a, f, k, c1,mn1,mx1,l01, c2,mn2,mx2,l02, c3,mn3,mx3,l03, c4,mn4,mx4,l04, c5,mn5,mx5,l05, t) {	\
 		.ai = a,											\
 		.fnc1 = f,											\
+		.dlPkey = k,											\
+		.minLen = mn1 + mn2 + mn3 + mn4 + mn5,								\
+		.maxLen = mx1 + mx2 + mx3 + mx4 + mx5,								\
 		.parts = {											\
-			{ .cset = cset_##c1, .min = mn1, .max = mx1, .linters[0] = lint_##l01 },		\
-			{ .cset = cset_##c2, .min = mn2, .max = mx2, .linters[0] = lint_##l02 },		\
-			{ .cset = cset_##c3, .min = mn3, .max = mx3, .linters[0] = lint_##l03 },		\
-			{ .cset = cset_##c4, .min = mn4, .max = mx4, .linters[0] = lint_##l04 },		\
-			{ .cset = cset_##c5, .min = mn5, .max = mx5, .linters[0] = lint_##l05 },		\
+			{ .cset = cset_##c1, .min = mn1, .max = mx1, .linters[0] = linter_##l01 },		\
+			{ .cset = cset_##c2, .min = mn2, .max = mx2, .linters[0] = linter_##l02 },		\
+			{ .cset = cset_##c3, .min = mn3, .max = mx3, .linters[0] = linter_##l03 },		\
+			{ .cset = cset_##c4, .min = mn4, .max = mx4, .linters[0] = linter_##l04 },		\
+			{ .cset = cset_##c5, .min = mn5, .max = mx5, .linters[0] = linter_##l05 },		\
 		},												\
 		.title = t,											\
 	}
 #define PASS_ON(...) __VA_ARGS__
 #define AI(...) PASS_ON(AI_VA(__VA_ARGS__))
 #define cset_0 0
-#define lint__ 0
+#define linter__ linter_none
 #define __ 0,0,0,_
 
-static const struct aiEntry ai_table[] = {
-	AI( "00"  , NO_FNC1, N,18,18,csum, __, __, __, __,                "SSCC"                      ),
-	AI( "01"  , NO_FNC1, N,14,14,csum, __, __, __, __,                "GTIN"                      ),
-	AI( "02"  , NO_FNC1, N,14,14,csum, __, __, __, __,                "CONTENT"                   ),
-	AI( "10"  , FNC1   , X,1,20,_, __, __, __, __,                    "BATCH/LOT"                 ),
-	AI( "11"  , NO_FNC1, N,6,6,_, __, __, __, __,                     "PROD DATE"                 ),
-	AI( "12"  , NO_FNC1, N,6,6,_, __, __, __, __,                     "DUE DATE"                  ),
-	AI( "13"  , NO_FNC1, N,6,6,_, __, __, __, __,                     "PACK DATE"                 ),
-	AI( "15"  , NO_FNC1, N,6,6,_, __, __, __, __,                     "BEST BEFORE or BEST BY"    ),
-	AI( "16"  , NO_FNC1, N,6,6,_, __, __, __, __,                     "SELL BY"                   ),
-	AI( "17"  , NO_FNC1, N,6,6,_, __, __, __, __,                     "USE BY or EXPIRY"          ),
-	AI( "20"  , NO_FNC1, N,2,2,_, __, __, __, __,                     "VARIANT"                   ),
-	AI( "21"  , FNC1   , X,1,20,_, __, __, __, __,                    "SERIAL"                    ),
-	AI( "22"  , FNC1   , X,1,20,_, __, __, __, __,                    "CPV"                       ),
-	AI( "235" , FNC1   , X,1,28,_, __, __, __, __,                    "TPX"                       ),
-	AI( "240" , FNC1   , X,1,30,_, __, __, __, __,                    "ADDITIONAL ID"             ),
-	AI( "241" , FNC1   , X,1,30,_, __, __, __, __,                    "CUST. PART NO."            ),
-	AI( "242" , FNC1   , N,1,6,_, __, __, __, __,                     "MTO VARIANT"               ),
-	AI( "243" , FNC1   , X,1,20,_, __, __, __, __,                    "PCN"                       ),
-	AI( "250" , FNC1   , X,1,30,_, __, __, __, __,                    "SECONDARY SERIAL"          ),
-	AI( "251" , FNC1   , X,1,30,_, __, __, __, __,                    "REF. TO SOURCE"            ),
-	AI( "253" , FNC1   , N,13,13,csum, X,0,17,_, __, __, __,          "GDTI"                      ),
-	AI( "254" , FNC1   , X,1,20,_, __, __, __, __,                    "GLN EXTENSION COMPONENT"   ),
-	AI( "255" , FNC1   , N,13,13,csum, N,0,12,_, __, __, __,          "GCN"                       ),
-	AI( "30"  , FNC1   , N,1,8,_, __, __, __, __,                     "VAR. COUNT"                ),
-	AI( "3100", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (kg)"           ),
-	AI( "3101", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (kg)"           ),
-	AI( "3102", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (kg)"           ),
-	AI( "3103", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (kg)"           ),
-	AI( "3104", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (kg)"           ),
-	AI( "3105", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (kg)"           ),
-	AI( "3110", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (m)"                ),
-	AI( "3111", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (m)"                ),
-	AI( "3112", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (m)"                ),
-	AI( "3113", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (m)"                ),
-	AI( "3114", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (m)"                ),
-	AI( "3115", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (m)"                ),
-	AI( "3120", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (m)"                 ),
-	AI( "3121", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (m)"                 ),
-	AI( "3122", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (m)"                 ),
-	AI( "3123", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (m)"                 ),
-	AI( "3124", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (m)"                 ),
-	AI( "3125", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (m)"                 ),
-	AI( "3130", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (m)"                ),
-	AI( "3131", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (m)"                ),
-	AI( "3132", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (m)"                ),
-	AI( "3133", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (m)"                ),
-	AI( "3134", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (m)"                ),
-	AI( "3135", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (m)"                ),
-	AI( "3140", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (m^2)"                ),
-	AI( "3141", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (m^2)"                ),
-	AI( "3142", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (m^2)"                ),
-	AI( "3143", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (m^2)"                ),
-	AI( "3144", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (m^2)"                ),
-	AI( "3145", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (m^2)"                ),
-	AI( "3150", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (l)"            ),
-	AI( "3151", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (l)"            ),
-	AI( "3152", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (l)"            ),
-	AI( "3153", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (l)"            ),
-	AI( "3154", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (l)"            ),
-	AI( "3155", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (l)"            ),
-	AI( "3160", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (m^3)"          ),
-	AI( "3161", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (m^3)"          ),
-	AI( "3162", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (m^3)"          ),
-	AI( "3163", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (m^3)"          ),
-	AI( "3164", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (m^3)"          ),
-	AI( "3165", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (m^3)"          ),
-	AI( "3200", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (lb)"           ),
-	AI( "3201", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (lb)"           ),
-	AI( "3202", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (lb)"           ),
-	AI( "3203", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (lb)"           ),
-	AI( "3204", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (lb)"           ),
-	AI( "3205", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (lb)"           ),
-	AI( "3210", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (i)"                ),
-	AI( "3211", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (i)"                ),
-	AI( "3212", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (i)"                ),
-	AI( "3213", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (i)"                ),
-	AI( "3214", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (i)"                ),
-	AI( "3215", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (i)"                ),
-	AI( "3220", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (f)"                ),
-	AI( "3221", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (f)"                ),
-	AI( "3222", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (f)"                ),
-	AI( "3223", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (f)"                ),
-	AI( "3224", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (f)"                ),
-	AI( "3225", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (f)"                ),
-	AI( "3230", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (y)"                ),
-	AI( "3231", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (y)"                ),
-	AI( "3232", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (y)"                ),
-	AI( "3233", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (y)"                ),
-	AI( "3234", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (y)"                ),
-	AI( "3235", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (y)"                ),
-	AI( "3240", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (i)"                 ),
-	AI( "3241", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (i)"                 ),
-	AI( "3242", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (i)"                 ),
-	AI( "3243", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (i)"                 ),
-	AI( "3244", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (i)"                 ),
-	AI( "3245", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (i)"                 ),
-	AI( "3250", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (f)"                 ),
-	AI( "3251", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (f)"                 ),
-	AI( "3252", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (f)"                 ),
-	AI( "3253", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (f)"                 ),
-	AI( "3254", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (f)"                 ),
-	AI( "3255", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (f)"                 ),
-	AI( "3260", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (y)"                 ),
-	AI( "3261", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (y)"                 ),
-	AI( "3262", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (y)"                 ),
-	AI( "3263", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (y)"                 ),
-	AI( "3264", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (y)"                 ),
-	AI( "3265", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (y)"                 ),
-	AI( "3270", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (i)"                ),
-	AI( "3271", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (i)"                ),
-	AI( "3272", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (i)"                ),
-	AI( "3273", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (i)"                ),
-	AI( "3274", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (i)"                ),
-	AI( "3275", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (i)"                ),
-	AI( "3280", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (f)"                ),
-	AI( "3281", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (f)"                ),
-	AI( "3282", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (f)"                ),
-	AI( "3283", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (f)"                ),
-	AI( "3284", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (f)"                ),
-	AI( "3285", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (f)"                ),
-	AI( "3290", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (y)"                ),
-	AI( "3291", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (y)"                ),
-	AI( "3292", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (y)"                ),
-	AI( "3293", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (y)"                ),
-	AI( "3294", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (y)"                ),
-	AI( "3295", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (y)"                ),
-	AI( "3300", NO_FNC1, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (kg)"         ),
-	AI( "3301", NO_FNC1, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (kg)"         ),
-	AI( "3302", NO_FNC1, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (kg)"         ),
-	AI( "3303", NO_FNC1, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (kg)"         ),
-	AI( "3304", NO_FNC1, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (kg)"         ),
-	AI( "3305", NO_FNC1, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (kg)"         ),
-	AI( "3310", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (m), log"           ),
-	AI( "3311", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (m), log"           ),
-	AI( "3312", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (m), log"           ),
-	AI( "3313", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (m), log"           ),
-	AI( "3314", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (m), log"           ),
-	AI( "3315", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (m), log"           ),
-	AI( "3320", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (m), log"            ),
-	AI( "3321", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (m), log"            ),
-	AI( "3322", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (m), log"            ),
-	AI( "3323", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (m), log"            ),
-	AI( "3324", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (m), log"            ),
-	AI( "3325", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (m), log"            ),
-	AI( "3330", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (m), log"           ),
-	AI( "3331", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (m), log"           ),
-	AI( "3332", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (m), log"           ),
-	AI( "3333", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (m), log"           ),
-	AI( "3334", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (m), log"           ),
-	AI( "3335", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (m), log"           ),
-	AI( "3340", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (m^2), log"           ),
-	AI( "3341", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (m^2), log"           ),
-	AI( "3342", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (m^2), log"           ),
-	AI( "3343", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (m^2), log"           ),
-	AI( "3344", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (m^2), log"           ),
-	AI( "3345", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (m^2), log"           ),
-	AI( "3350", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (l), log"           ),
-	AI( "3351", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (l), log"           ),
-	AI( "3352", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (l), log"           ),
-	AI( "3353", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (l), log"           ),
-	AI( "3354", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (l), log"           ),
-	AI( "3355", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (l), log"           ),
-	AI( "3360", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (m^3), log"         ),
-	AI( "3361", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (m^3), log"         ),
-	AI( "3362", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (m^3), log"         ),
-	AI( "3363", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (m^3), log"         ),
-	AI( "3364", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (m^3), log"         ),
-	AI( "3365", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (m^3), log"         ),
-	AI( "3370", NO_FNC1, N,6,6,_, __, __, __, __,                     "KG PER m^2"                ),
-	AI( "3371", NO_FNC1, N,6,6,_, __, __, __, __,                     "KG PER m^2"                ),
-	AI( "3372", NO_FNC1, N,6,6,_, __, __, __, __,                     "KG PER m^2"                ),
-	AI( "3373", NO_FNC1, N,6,6,_, __, __, __, __,                     "KG PER m^2"                ),
-	AI( "3374", NO_FNC1, N,6,6,_, __, __, __, __,                     "KG PER m^2"                ),
-	AI( "3375", NO_FNC1, N,6,6,_, __, __, __, __,                     "KG PER m^2"                ),
-	AI( "3400", NO_FNC1, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (lb)"         ),
-	AI( "3401", NO_FNC1, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (lb)"         ),
-	AI( "3402", NO_FNC1, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (lb)"         ),
-	AI( "3403", NO_FNC1, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (lb)"         ),
-	AI( "3404", NO_FNC1, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (lb)"         ),
-	AI( "3405", NO_FNC1, N,6,6,_, __, __, __, __,                     "GROSS WEIGHT (lb)"         ),
-	AI( "3410", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (i), log"           ),
-	AI( "3411", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (i), log"           ),
-	AI( "3412", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (i), log"           ),
-	AI( "3413", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (i), log"           ),
-	AI( "3414", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (i), log"           ),
-	AI( "3415", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (i), log"           ),
-	AI( "3420", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (f), log"           ),
-	AI( "3421", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (f), log"           ),
-	AI( "3422", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (f), log"           ),
-	AI( "3423", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (f), log"           ),
-	AI( "3424", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (f), log"           ),
-	AI( "3425", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (f), log"           ),
-	AI( "3430", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (y), log"           ),
-	AI( "3431", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (y), log"           ),
-	AI( "3432", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (y), log"           ),
-	AI( "3433", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (y), log"           ),
-	AI( "3434", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (y), log"           ),
-	AI( "3435", NO_FNC1, N,6,6,_, __, __, __, __,                     "LENGTH (y), log"           ),
-	AI( "3440", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (i), log"            ),
-	AI( "3441", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (i), log"            ),
-	AI( "3442", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (i), log"            ),
-	AI( "3443", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (i), log"            ),
-	AI( "3444", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (i), log"            ),
-	AI( "3445", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (i), log"            ),
-	AI( "3450", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (f), log"            ),
-	AI( "3451", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (f), log"            ),
-	AI( "3452", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (f), log"            ),
-	AI( "3453", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (f), log"            ),
-	AI( "3454", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (f), log"            ),
-	AI( "3455", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (f), log"            ),
-	AI( "3460", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (y), log"            ),
-	AI( "3461", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (y), log"            ),
-	AI( "3462", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (y), log"            ),
-	AI( "3463", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (y), log"            ),
-	AI( "3464", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (y), log"            ),
-	AI( "3465", NO_FNC1, N,6,6,_, __, __, __, __,                     "WIDTH (y), log"            ),
-	AI( "3470", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (i), log"           ),
-	AI( "3471", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (i), log"           ),
-	AI( "3472", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (i), log"           ),
-	AI( "3473", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (i), log"           ),
-	AI( "3474", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (i), log"           ),
-	AI( "3475", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (i), log"           ),
-	AI( "3480", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (f), log"           ),
-	AI( "3481", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (f), log"           ),
-	AI( "3482", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (f), log"           ),
-	AI( "3483", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (f), log"           ),
-	AI( "3484", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (f), log"           ),
-	AI( "3485", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (f), log"           ),
-	AI( "3490", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (y), log"           ),
-	AI( "3491", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (y), log"           ),
-	AI( "3492", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (y), log"           ),
-	AI( "3493", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (y), log"           ),
-	AI( "3494", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (y), log"           ),
-	AI( "3495", NO_FNC1, N,6,6,_, __, __, __, __,                     "HEIGHT (y), log"           ),
-	AI( "3500", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (i^2)"                ),
-	AI( "3501", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (i^2)"                ),
-	AI( "3502", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (i^2)"                ),
-	AI( "3503", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (i^2)"                ),
-	AI( "3504", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (i^2)"                ),
-	AI( "3505", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (i^2)"                ),
-	AI( "3510", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (f^2)"                ),
-	AI( "3511", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (f^2)"                ),
-	AI( "3512", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (f^2)"                ),
-	AI( "3513", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (f^2)"                ),
-	AI( "3514", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (f^2)"                ),
-	AI( "3515", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (f^2)"                ),
-	AI( "3520", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (y^2)"                ),
-	AI( "3521", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (y^2)"                ),
-	AI( "3522", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (y^2)"                ),
-	AI( "3523", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (y^2)"                ),
-	AI( "3524", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (y^2)"                ),
-	AI( "3525", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (y^2)"                ),
-	AI( "3530", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (i^2), log"           ),
-	AI( "3531", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (i^2), log"           ),
-	AI( "3532", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (i^2), log"           ),
-	AI( "3533", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (i^2), log"           ),
-	AI( "3534", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (i^2), log"           ),
-	AI( "3535", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (i^2), log"           ),
-	AI( "3540", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (f^2), log"           ),
-	AI( "3541", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (f^2), log"           ),
-	AI( "3542", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (f^2), log"           ),
-	AI( "3543", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (f^2), log"           ),
-	AI( "3544", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (f^2), log"           ),
-	AI( "3545", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (f^2), log"           ),
-	AI( "3550", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (y^2), log"           ),
-	AI( "3551", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (y^2), log"           ),
-	AI( "3552", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (y^2), log"           ),
-	AI( "3553", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (y^2), log"           ),
-	AI( "3554", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (y^2), log"           ),
-	AI( "3555", NO_FNC1, N,6,6,_, __, __, __, __,                     "AREA (y^2), log"           ),
-	AI( "3560", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (t)"            ),
-	AI( "3561", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (t)"            ),
-	AI( "3562", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (t)"            ),
-	AI( "3563", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (t)"            ),
-	AI( "3564", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (t)"            ),
-	AI( "3565", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET WEIGHT (t)"            ),
-	AI( "3570", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (oz)"           ),
-	AI( "3571", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (oz)"           ),
-	AI( "3572", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (oz)"           ),
-	AI( "3573", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (oz)"           ),
-	AI( "3574", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (oz)"           ),
-	AI( "3575", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (oz)"           ),
-	AI( "3600", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (q)"            ),
-	AI( "3601", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (q)"            ),
-	AI( "3602", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (q)"            ),
-	AI( "3603", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (q)"            ),
-	AI( "3604", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (q)"            ),
-	AI( "3605", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (q)"            ),
-	AI( "3610", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (g)"            ),
-	AI( "3611", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (g)"            ),
-	AI( "3612", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (g)"            ),
-	AI( "3613", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (g)"            ),
-	AI( "3614", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (g)"            ),
-	AI( "3615", NO_FNC1, N,6,6,_, __, __, __, __,                     "NET VOLUME (g)"            ),
-	AI( "3620", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (q), log"           ),
-	AI( "3621", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (q), log"           ),
-	AI( "3622", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (q), log"           ),
-	AI( "3623", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (q), log"           ),
-	AI( "3624", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (q), log"           ),
-	AI( "3625", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (q), log"           ),
-	AI( "3630", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (g), log"           ),
-	AI( "3631", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (g), log"           ),
-	AI( "3632", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (g), log"           ),
-	AI( "3633", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (g), log"           ),
-	AI( "3634", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (g), log"           ),
-	AI( "3635", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (g), log"           ),
-	AI( "3640", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (i^3)"              ),
-	AI( "3641", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (i^3)"              ),
-	AI( "3642", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (i^3)"              ),
-	AI( "3643", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (i^3)"              ),
-	AI( "3644", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (i^3)"              ),
-	AI( "3645", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (i^3)"              ),
-	AI( "3650", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (f^3)"              ),
-	AI( "3651", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (f^3)"              ),
-	AI( "3652", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (f^3)"              ),
-	AI( "3653", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (f^3)"              ),
-	AI( "3654", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (f^3)"              ),
-	AI( "3655", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (f^3)"              ),
-	AI( "3660", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (y^3)"              ),
-	AI( "3661", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (y^3)"              ),
-	AI( "3662", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (y^3)"              ),
-	AI( "3663", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (y^3)"              ),
-	AI( "3664", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (y^3)"              ),
-	AI( "3665", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (y^3)"              ),
-	AI( "3670", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (i^3), log"         ),
-	AI( "3671", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (i^3), log"         ),
-	AI( "3672", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (i^3), log"         ),
-	AI( "3673", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (i^3), log"         ),
-	AI( "3674", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (i^3), log"         ),
-	AI( "3675", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (i^3), log"         ),
-	AI( "3680", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (f^3), log"         ),
-	AI( "3681", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (f^3), log"         ),
-	AI( "3682", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (f^3), log"         ),
-	AI( "3683", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (f^3), log"         ),
-	AI( "3684", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (f^3), log"         ),
-	AI( "3685", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (f^3), log"         ),
-	AI( "3690", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (y^3), log"         ),
-	AI( "3691", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (y^3), log"         ),
-	AI( "3692", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (y^3), log"         ),
-	AI( "3693", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (y^3), log"         ),
-	AI( "3694", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (y^3), log"         ),
-	AI( "3695", NO_FNC1, N,6,6,_, __, __, __, __,                     "VOLUME (y^3), log"         ),
-	AI( "37"  , FNC1   , N,1,8,_, __, __, __, __,                     "COUNT"                     ),
-	AI( "3900", FNC1   , N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
-	AI( "3901", FNC1   , N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
-	AI( "3902", FNC1   , N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
-	AI( "3903", FNC1   , N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
-	AI( "3904", FNC1   , N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
-	AI( "3905", FNC1   , N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
-	AI( "3906", FNC1   , N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
-	AI( "3907", FNC1   , N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
-	AI( "3908", FNC1   , N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
-	AI( "3909", FNC1   , N,1,15,_, __, __, __, __,                    "AMOUNT"                    ),
-	AI( "3910", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
-	AI( "3911", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
-	AI( "3912", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
-	AI( "3913", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
-	AI( "3914", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
-	AI( "3915", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
-	AI( "3916", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
-	AI( "3917", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
-	AI( "3918", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
-	AI( "3919", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "AMOUNT"                    ),
-	AI( "3920", FNC1   , N,1,15,_, __, __, __, __,                    "PRICE"                     ),
-	AI( "3921", FNC1   , N,1,15,_, __, __, __, __,                    "PRICE"                     ),
-	AI( "3922", FNC1   , N,1,15,_, __, __, __, __,                    "PRICE"                     ),
-	AI( "3923", FNC1   , N,1,15,_, __, __, __, __,                    "PRICE"                     ),
-	AI( "3924", FNC1   , N,1,15,_, __, __, __, __,                    "PRICE"                     ),
-	AI( "3925", FNC1   , N,1,15,_, __, __, __, __,                    "PRICE"                     ),
-	AI( "3926", FNC1   , N,1,15,_, __, __, __, __,                    "PRICE"                     ),
-	AI( "3927", FNC1   , N,1,15,_, __, __, __, __,                    "PRICE"                     ),
-	AI( "3928", FNC1   , N,1,15,_, __, __, __, __,                    "PRICE"                     ),
-	AI( "3929", FNC1   , N,1,15,_, __, __, __, __,                    "PRICE"                     ),
-	AI( "3930", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
-	AI( "3931", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
-	AI( "3932", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
-	AI( "3933", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
-	AI( "3934", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
-	AI( "3935", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
-	AI( "3936", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
-	AI( "3937", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
-	AI( "3938", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
-	AI( "3939", FNC1   , N,3,3,_, N,1,15,_, __, __, __,               "PRICE"                     ),
-	AI( "3940", FNC1   , N,4,4,_, __, __, __, __,                     "PRCNT OFF"                 ),
-	AI( "3941", FNC1   , N,4,4,_, __, __, __, __,                     "PRCNT OFF"                 ),
-	AI( "3942", FNC1   , N,4,4,_, __, __, __, __,                     "PRCNT OFF"                 ),
-	AI( "3943", FNC1   , N,4,4,_, __, __, __, __,                     "PRCNT OFF"                 ),
-	AI( "3950", FNC1   , N,6,6,_, __, __, __, __,                     "PRICE/UoM"                 ),
-	AI( "3951", FNC1   , N,6,6,_, __, __, __, __,                     "PRICE/UoM"                 ),
-	AI( "3952", FNC1   , N,6,6,_, __, __, __, __,                     "PRICE/UoM"                 ),
-	AI( "3953", FNC1   , N,6,6,_, __, __, __, __,                     "PRICE/UoM"                 ),
-	AI( "3954", FNC1   , N,6,6,_, __, __, __, __,                     "PRICE/UoM"                 ),
-	AI( "3955", FNC1   , N,6,6,_, __, __, __, __,                     "PRICE/UoM"                 ),
-	AI( "400" , FNC1   , X,1,30,_, __, __, __, __,                    "ORDER NUMBER"              ),
-	AI( "401" , FNC1   , X,1,30,_, __, __, __, __,                    "GINC"                      ),
-	AI( "402" , FNC1   , N,17,17,csum, __, __, __, __,                "GSIN"                      ),
-	AI( "403" , FNC1   , X,1,30,_, __, __, __, __,                    "ROUTE"                     ),
-	AI( "410" , NO_FNC1, N,13,13,csum, __, __, __, __,                "SHIP TO LOC"               ),
-	AI( "411" , NO_FNC1, N,13,13,csum, __, __, __, __,                "BILL TO"                   ),
-	AI( "412" , NO_FNC1, N,13,13,csum, __, __, __, __,                "PURCHASE FROM"             ),
-	AI( "413" , NO_FNC1, N,13,13,csum, __, __, __, __,                "SHIP FOR LOC"              ),
-	AI( "414" , NO_FNC1, N,13,13,csum, __, __, __, __,                "LOC NO."                   ),
-	AI( "415" , NO_FNC1, N,13,13,csum, __, __, __, __,                "PAY TO"                    ),
-	AI( "416" , NO_FNC1, N,13,13,csum, __, __, __, __,                "PROD/SERV LOC"             ),
-	AI( "417" , NO_FNC1, N,13,13,csum, __, __, __, __,                "PARTY"                     ),
-	AI( "420" , FNC1   , X,1,20,_, __, __, __, __,                    "SHIP TO POST"              ),
-	AI( "421" , FNC1   , N,3,3,_, X,1,9,_, __, __, __,                "SHIP TO POST"              ),
-	AI( "422" , FNC1   , N,3,3,_, __, __, __, __,                     "ORIGIN"                    ),
-	AI( "423" , FNC1   , N,3,15,_, __, __, __, __,                    "COUNTRY - INITIAL PROCESS" ),
-	AI( "424" , FNC1   , N,3,3,_, __, __, __, __,                     "COUNTRY - PROCESS"         ),
-	AI( "425" , FNC1   , N,3,15,_, __, __, __, __,                    "COUNTRY - DISASSEMBLY"     ),
-	AI( "426" , FNC1   , N,3,3,_, __, __, __, __,                     "COUNTRY - FULL PROCESS"    ),
-	AI( "427" , FNC1   , X,1,3,_, __, __, __, __,                     "ORIGIN SUBDIVISION"        ),
-	AI( "4300", FNC1   , X,1,35,_, __, __, __, __,                    "SHIP TO COMP"              ),
-	AI( "4301", FNC1   , X,1,35,_, __, __, __, __,                    "SHIP TO NAME"              ),
-	AI( "4302", FNC1   , X,1,70,_, __, __, __, __,                    "SHIP TO ADD1"              ),
-	AI( "4303", FNC1   , X,1,70,_, __, __, __, __,                    "SHIP TO ADD2"              ),
-	AI( "4304", FNC1   , X,1,70,_, __, __, __, __,                    "SHIP TO SUB"               ),
-	AI( "4305", FNC1   , X,1,70,_, __, __, __, __,                    "SHIP TO LOC"               ),
-	AI( "4306", FNC1   , X,1,70,_, __, __, __, __,                    "SHIP TO REG"               ),
-	AI( "4307", FNC1   , X,2,2,_, __, __, __, __,                     "SHIP TO COUNTRY"           ),
-	AI( "4308", FNC1   , X,1,30,_, __, __, __, __,                    "SHIP TO PHONE"             ),
-	AI( "4310", FNC1   , X,1,35,_, __, __, __, __,                    "RTN TO COMP"               ),
-	AI( "4311", FNC1   , X,1,35,_, __, __, __, __,                    "RTN TO NAME"               ),
-	AI( "4312", FNC1   , X,1,70,_, __, __, __, __,                    "RTN TO ADD1"               ),
-	AI( "4313", FNC1   , X,1,70,_, __, __, __, __,                    "RTN TO ADD2"               ),
-	AI( "4314", FNC1   , X,1,70,_, __, __, __, __,                    "RTN TO SUB"                ),
-	AI( "4315", FNC1   , X,1,70,_, __, __, __, __,                    "RTN TO LOC"                ),
-	AI( "4316", FNC1   , X,1,70,_, __, __, __, __,                    "RTN TO REG"                ),
-	AI( "4317", FNC1   , X,2,2,_, __, __, __, __,                     "RTN TO COUNTRY"            ),
-	AI( "4318", FNC1   , X,1,20,_, __, __, __, __,                    "RTN TO POST"               ),
-	AI( "4319", FNC1   , X,1,30,_, __, __, __, __,                    "RTN TO PHONE"              ),
-	AI( "4320", FNC1   , X,1,35,_, __, __, __, __,                    "SRV DESCRIPTION"           ),
-	AI( "4321", FNC1   , N,1,1,_, __, __, __, __,                     "DANGEROUS GOODS"           ),
-	AI( "4322", FNC1   , N,1,1,_, __, __, __, __,                     "AUTH LEAVE"                ),
-	AI( "4323", FNC1   , N,1,1,_, __, __, __, __,                     "SIG REQUIRED"              ),
-	AI( "4324", FNC1   , N,6,6,_, N,4,4,_, __, __, __,                "NBEF DEL DT."              ),
-	AI( "4325", FNC1   , N,6,6,_, N,4,4,_, __, __, __,                "NAFT DEL DT."              ),
-	AI( "4326", FNC1   , N,6,6,_, __, __, __, __,                     "REL DATE"                  ),
-	AI( "7001", FNC1   , N,13,13,_, __, __, __, __,                   "NSN"                       ),
-	AI( "7002", FNC1   , X,1,30,_, __, __, __, __,                    "MEAT CUT"                  ),
-	AI( "7003", FNC1   , N,6,6,_, N,4,4,_, __, __, __,                "EXPIRY TIME"               ),
-	AI( "7004", FNC1   , N,1,4,_, __, __, __, __,                     "ACTIVE POTENCY"            ),
-	AI( "7005", FNC1   , X,1,12,_, __, __, __, __,                    "CATCH AREA"                ),
-	AI( "7006", FNC1   , N,6,6,_, __, __, __, __,                     "FIRST FREEZE DATE"         ),
-	AI( "7007", FNC1   , N,6,6,_, N,0,6,_, __, __, __,                "HARVEST DATE"              ),
-	AI( "7008", FNC1   , X,1,3,_, __, __, __, __,                     "AQUATIC SPECIES"           ),
-	AI( "7009", FNC1   , X,1,10,_, __, __, __, __,                    "FISHING GEAR TYPE"         ),
-	AI( "7010", FNC1   , X,1,2,_, __, __, __, __,                     "PROD METHOD"               ),
-	AI( "7020", FNC1   , X,1,20,_, __, __, __, __,                    "REFURB LOT"                ),
-	AI( "7021", FNC1   , X,1,20,_, __, __, __, __,                    "FUNC STAT"                 ),
-	AI( "7022", FNC1   , X,1,20,_, __, __, __, __,                    "REV STAT"                  ),
-	AI( "7023", FNC1   , X,1,30,_, __, __, __, __,                    "GIAI - ASSEMBLY"           ),
-	AI( "7030", FNC1   , N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
-	AI( "7031", FNC1   , N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
-	AI( "7032", FNC1   , N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
-	AI( "7033", FNC1   , N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
-	AI( "7034", FNC1   , N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
-	AI( "7035", FNC1   , N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
-	AI( "7036", FNC1   , N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
-	AI( "7037", FNC1   , N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
-	AI( "7038", FNC1   , N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
-	AI( "7039", FNC1   , N,3,3,_, X,1,27,_, __, __, __,               "PROCESSOR # s"             ),
-	AI( "7040", FNC1   , N,1,1,_, X,1,1,_, X,1,1,_, X,1,1,_, __,      "UIC+EXT"                   ),
-	AI( "710" , FNC1   , X,1,20,_, __, __, __, __,                    "NHRN PZN"                  ),
-	AI( "711" , FNC1   , X,1,20,_, __, __, __, __,                    "NHRN CIP"                  ),
-	AI( "712" , FNC1   , X,1,20,_, __, __, __, __,                    "NHRN CN"                   ),
-	AI( "713" , FNC1   , X,1,20,_, __, __, __, __,                    "NHRN DRN"                  ),
-	AI( "714" , FNC1   , X,1,20,_, __, __, __, __,                    "NHRN AIM"                  ),
-	AI( "7230", FNC1   , X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
-	AI( "7231", FNC1   , X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
-	AI( "7232", FNC1   , X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
-	AI( "7233", FNC1   , X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
-	AI( "7234", FNC1   , X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
-	AI( "7235", FNC1   , X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
-	AI( "7236", FNC1   , X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
-	AI( "7237", FNC1   , X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
-	AI( "7238", FNC1   , X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
-	AI( "7239", FNC1   , X,2,2,_, X,1,28,_, __, __, __,               "CERT # s"                  ),
-	AI( "7240", FNC1   , X,1,20,_, __, __, __, __,                    "PROTOCOL"                  ),
-	AI( "8001", FNC1   , N,4,4,_, N,5,5,_, N,3,3,_, N,1,1,_, N,1,1,_, "DIMENSIONS"                ),
-	AI( "8002", FNC1   , X,1,20,_, __, __, __, __,                    "CMT NO."                   ),
-	AI( "8003", FNC1   , N,1,1,_, N,13,13,csum, X,0,16,_, __, __,     "GRAI"                      ),
-	AI( "8004", FNC1   , X,1,30,_, __, __, __, __,                    "GIAI"                      ),
-	AI( "8005", FNC1   , N,6,6,_, __, __, __, __,                     "PRICE PER UNIT"            ),
-	AI( "8006", FNC1   , N,14,14,csum, N,4,4,_, __, __, __,           "ITIP"                      ),
-	AI( "8007", FNC1   , X,1,34,_, __, __, __, __,                    "IBAN"                      ),
-	AI( "8008", FNC1   , N,8,8,_, N,0,4,_, __, __, __,                "PROD TIME"                 ),
-	AI( "8009", FNC1   , X,1,50,_, __, __, __, __,                    "OPTSEN"                    ),
-	AI( "8010", FNC1   , C,1,30,_, __, __, __, __,                    "CPID"                      ),
-	AI( "8011", FNC1   , N,1,12,_, __, __, __, __,                    "CPID SERIAL"               ),
-	AI( "8012", FNC1   , X,1,20,_, __, __, __, __,                    "VERSION"                   ),
-	AI( "8013", FNC1   , X,1,25,csumalpha, __, __, __, __,            "GMN"                       ),
-	AI( "8017", FNC1   , N,18,18,csum, __, __, __, __,                "GSRN - PROVIDER"           ),
-	AI( "8018", FNC1   , N,18,18,csum, __, __, __, __,                "GSRN - RECIPIENT"          ),
-	AI( "8019", FNC1   , N,1,10,_, __, __, __, __,                    "SRIN"                      ),
-	AI( "8020", FNC1   , X,1,25,_, __, __, __, __,                    "REF NO."                   ),
-	AI( "8026", FNC1   , N,14,14,csum, N,4,4,_, __, __, __,           "ITIP CONTENT"              ),
-	AI( "8110", FNC1   , X,1,70,_, __, __, __, __,                    ""                          ),
-	AI( "8111", FNC1   , N,4,4,_, __, __, __, __,                     "POINTS"                    ),
-	AI( "8112", FNC1   , X,1,70,_, __, __, __, __,                    ""                          ),
-	AI( "8200", FNC1   , X,1,70,_, __, __, __, __,                    "PRODUCT URL"               ),
-	AI( "90"  , FNC1   , X,1,30,_, __, __, __, __,                    "INTERNAL"                  ),
-	AI( "91"  , FNC1   , X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
-	AI( "92"  , FNC1   , X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
-	AI( "93"  , FNC1   , X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
-	AI( "94"  , FNC1   , X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
-	AI( "95"  , FNC1   , X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
-	AI( "96"  , FNC1   , X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
-	AI( "97"  , FNC1   , X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
-	AI( "98"  , FNC1   , X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
-	AI( "99"  , FNC1   , X,1,90,_, __, __, __, __,                    "INTERNAL"                  ),
+/*
+ *  The AI table and its lookup index are generated from the syntax dictionary
+ *  in gs1-format-spec.txt by build-gs1-syntax-dict.pl
+ *
+ *  The table is in sorted order, so the entries that share the first three
+ *  digits of their AI are contiguous, and any two digit AI is the first entry
+ *  of the group for its prefix followed by "0". The index records the position
+ *  of the first entry in each group so that a lookup only examines the few
+ *  entries in a single group.
+ *
+ */
+#include "ai-table.h"
+
+
+// Linter functions by their linterId_t
+static const linter_t linterFns[NUM_LINTERS] = {
+	[linter_none]		= NULL,
+	[linter_csum]		= lint_csum,
+	[linter_csumalpha]	= lint_csumalpha,
 };
 
 
+/*
+ *  Component validation operations
+ *
+ *  Each component of an AI value is validated by a single operation that is
+ *  selected by its character set and linter. The common combinations are
+ *  fused so that the character set check and any check character calculation
+ *  take one pass over the value in place. Other combinations check the
+ *  character set and then run the linter function.
+ *
+ */
+typedef enum {
+	vop_cset82 = 0,
+	vop_cset82_csumalpha,
+	vop_cset39,
+	vop_numeric,
+	vop_numeric_csum,
+	vop_linter,
+} vop_t;
+
+static const uint8_t componentOps[cset_C+1][NUM_LINTERS] = {
+	[cset_X] = {
+		[linter_none]		= vop_cset82,
+		[linter_csum]		= vop_linter,
+		[linter_csumalpha]	= vop_cset82_csumalpha,
+	},
+	[cset_N] = {
+		[linter_none]		= vop_numeric,
+		[linter_csum]		= vop_numeric_csum,
+		[linter_csumalpha]	= vop_linter,
+	},
+	[cset_C] = {
+		[linter_none]		= vop_cset39,
+		[linter_csum]		= vop_linter,
+		[linter_csumalpha]	= vop_linter,
+	},
+};
+
+static const uint8_t csetClass[cset_C+1] = {
+	[cset_X] = CC_CSET82,
+	[cset_N] = CC_DIGIT,
+	[cset_C] = CC_CSET39,
+};
+
+
+static bool validateComponent(gs1_encoder *ctx, const struct aiEntry *entry, const struct aiComponent *part, const char *val, const size_t len, const int offset) {
+
+	size_t i;
+	int parity;
+	uint32_t sum;
+	uint8_t pos;
+
+	switch (componentOps[part->cset][part->linters[0]]) {
+
+	case vop_cset82:
+		DEBUG_PRINT("      cset82...");
+		if ((i = gs1_spanClass((const uint8_t*)val, len, CC_CSET82)) != len)
+			return fail_ai(ctx, entry, gs1_encoder_eAI_CSET82, offset + (int)i);
+		break;
+
+	case vop_cset82_csumalpha:
+		DEBUG_PRINT("      cset82, csumalpha...");
+		sum = 0;
+		for (i = 0; i < len; i++) {
+			if ((pos = cset82Pos[(uint8_t)val[i]]) == 0)
+				return fail_ai(ctx, entry, gs1_encoder_eAI_CSET82, offset + (int)i);
+			if (i + 2 < len && len <= SIZEOF_ARRAY(primes))
+				sum += (uint32_t)(pos - 1) * primes[len - 3 - i];
+		}
+		if (len < 2 || len > SIZEOF_ARRAY(primes) || !csumalphaMatches(val + len - 2, sum))
+			return fail_csumalpha(ctx, entry, len, offset);
+		break;
+
+	case vop_cset39:
+		DEBUG_PRINT("      cset39...");
+		if ((i = gs1_spanClass((const uint8_t*)val, len, CC_CSET39)) != len)
+			return fail_ai(ctx, entry, gs1_encoder_eAI_CSET39, offset + (int)i);
+		break;
+
+	case vop_numeric:
+		DEBUG_PRINT("      csetNumeric...");
+		if ((i = gs1_spanDigits((const uint8_t*)val, len)) != len)
+			return fail_ai(ctx, entry, gs1_encoder_eAI_NON_DIGIT, offset + (int)i);
+		break;
+
+	case vop_numeric_csum:
+		DEBUG_PRINT("      csetNumeric, csum...");
+		if (len == 0)
+			return fail_ai(ctx, entry, gs1_encoder_eAI_CHECK_DIGIT, offset);
+		if ((parity = gs1_checkDigit((const uint8_t*)val, len - 1)) < 0 ||
+		    val[len - 1] < '0' || val[len - 1] > '9')
+			return fail_ai(ctx, entry, gs1_encoder_eAI_NON_DIGIT, offset + (int)gs1_spanDigits((const uint8_t*)val, len));
+		if (parity + '0' != val[len - 1])
+			return fail_ai(ctx, entry, gs1_encoder_eAI_CHECK_DIGIT, offset + (int)len - 1);
+		break;
+
+	default:
+		DEBUG_PRINT("      cset...");
+		if ((i = gs1_spanClass((const uint8_t*)val, len, csetClass[part->cset])) != len)
+			return fail_ai(ctx, entry, csetErrors[part->cset], offset + (int)i);
+		if (!linterFns[part->linters[0]](ctx, entry, val, len, offset))
+			return false;
+		break;
+
+	}
+	DEBUG_PRINT(" success\n");
+
+	// Any further linters on the component
+	for (i = 1; i < SIZEOF_ARRAY(part->linters); i++) {
+		if (part->linters[i] == linter_none)
+			break;
+		if (!linterFns[part->linters[i]](ctx, entry, val, len, offset))
+			return false;
+	}
+
+	return true;
+
+}
+
+
+void gs1_setBuiltinAItable(gs1_encoder *ctx) {
+	ctx->aiTable = ai_table;
+	ctx->aiIndex = ai_index;
+	ctx->aiTableSize = SIZEOF_ARRAY(ai_table);
+	ctx->aiAssoc = ai_assoc;
+	ctx->aiAssocSize = SIZEOF_ARRAY(ai_assoc);
+}
+
+
 // AI entry allowing AIs to be processed that are not present in the above table
 static const struct aiEntry unknownAI =
-	AI( ""    , FNC1   , X,1,90,_, __, __, __, __,                    "UNKNOWN"                   );
+	AI( ""    , FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "UNKNOWN"                   );
 static const struct aiEntry unknownAI2 =
-	AI( "XX"  , FNC1   , X,1,90,_, __, __, __, __,                    "UNKNOWN"                   );
+	AI( "XX"  , FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "UNKNOWN"                   );
 static const struct aiEntry unknownAI3 =
-	AI( "XXX" , FNC1   , X,1,90,_, __, __, __, __,                    "UNKNOWN"                   );
+	AI( "XXX" , FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "UNKNOWN"                   );
 static const struct aiEntry unknownAI4 =
-	AI( "XXXX", FNC1   , X,1,90,_, __, __, __, __,                    "UNKNOWN"                   );
+	AI( "XXXX", FNC1   , NO_DL_PKEY, X,1,90,_, __, __, __, __,                    "UNKNOWN"                   );
 
 
 /*
@@ -829,9 +500,10 @@ static const struct aiEntry unknownAI4 =
  */
 const struct aiEntry* gs1_lookupAIentry(gs1_encoder *ctx, const char *p, size_t ailen) {
 
-	size_t i;
+	uint16_t i;
 	const struct aiEntry *entry;
 	size_t entrylen, lenByPrefix;
+	int key;
 
 	assert(ailen <= strlen(p));
 
@@ -839,25 +511,34 @@ const struct aiEntry* gs1_lookupAIentry(gs1_encoder *ctx, const char *p, size_t
 		return NULL;
 
 	/*
-	 * Walk the AI table to find an entry that matches a prefix, optionally
-	 * ensuring that the AI also has a specified length
+	 * Find the entry that matches a prefix, optionally ensuring that the AI
+	 * also has a specified length. The shortest match is found first since
+	 * a two digit AI sorts ahead of the group in which it is indexed.
 	 *
 	 */
-	for (i = 0; i < SIZEOF_ARRAY(ai_table); i++) {
-		entry = &ai_table[i];
-		entrylen = strlen(entry->ai);
-		if (strncmp(p, entry->ai, entrylen) == 0) {
-			if (ailen != 0 && entrylen != ailen)
-				return NULL;	// Prefix match, but incorrect length
-			break;			// Found
+	if ((key = aiPrefix2(p)) >= 0) {
+		key *= 10;
+		i = ctx->aiIndex[key];
+		if (i < ctx->aiIndex[key+1] && ctx->aiTable[i].ai[2] == '\0')
+			return ailen == 0 || ailen == 2 ? &ctx->aiTable[i] : NULL;
+
+		// Don't vivify an AI that is a prefix of a known AI
+		if (ailen == 2 && i != ctx->aiIndex[key+10])
+			return NULL;
+
+		if (p[2] >= '0' && p[2] <= '9') {
+			key += p[2] - '0';
+			for (i = ctx->aiIndex[key]; i < ctx->aiIndex[key+1]; i++) {
+				entry = &ctx->aiTable[i];
+				entrylen = strlen(entry->ai);
+				if (strncmp(p, entry->ai, entrylen) == 0)
+					return ailen == 0 || ailen == entrylen ? entry : NULL;
+			}
+			if (ailen == 3 && ctx->aiIndex[key] != ctx->aiIndex[key+1])
+				return NULL;
 		}
-		if (ailen != 0 && strncmp(p, entry->ai, ailen) == 0)
-			return NULL;	// Don't vivify an AI that is a prefix of a known AI
 	}
 
-	if (i != SIZEOF_ARRAY(ai_table))
-		return entry;
-
 	if (!ctx->permitUnknownAIs)
 		return NULL;
 
@@ -890,10 +571,8 @@ const struct aiEntry* gs1_lookupAIentry(gs1_encoder *ctx, const char *p, size_t
 static size_t validate_ai_val(gs1_encoder *ctx, const struct aiEntry *entry, const char *start, const char *end) {
 
 	const struct aiComponent *part;
-	size_t i, j;
-	char compval[MAX_AI_LEN+1];
+	size_t i;
 	size_t complen;
-	linter_t linter;
 	const char *p, *r;
 
 	assert(ctx);
@@ -907,12 +586,11 @@ static size_t validate_ai_val(gs1_encoder *ctx, const struct aiEntry *entry, con
 	p = start;
 	r = end;
 	if (p == r) {
-		sprintf(ctx->errMsg, "AI (%s) data is empty", entry->ai);
-		ctx->errFlag = true;
+		gs1_setError(ctx, gs1_encoder_eAI_VALUE_EMPTY, entry->ai, strlen(entry->ai), 0);
 		return 0;
 	}
 
-	for (i = 0; i < SIZEOF_ARRAY(ai_table[0].parts); i++) {
+	for (i = 0; i < SIZEOF_ARRAY(entry->parts); i++) {
 		part = &entry->parts[i];
 		if (part->cset == cset_none)
 			break;
@@ -920,30 +598,18 @@ static size_t validate_ai_val(gs1_encoder *ctx, const struct aiEntry *entry, con
 		complen = (size_t)(r-p);	// Until given FNC1 or end...
 		if (part->max < r-p)
 			complen = part->max;	// ... reduced to max length of component
-		strncpy(compval, p, complen);
-		compval[complen] = '\0';
-		p += complen;
 
-		DEBUG_PRINT("    Validating component: %s\n", compval);
+		DEBUG_PRINT("    Validating component: %.*s\n", (int)complen, p);
 
 		if (complen < part->min) {
-			sprintf(ctx->errMsg, "AI (%s) data is too short", entry->ai);
-			ctx->errFlag = true;
+			gs1_setError(ctx, gs1_encoder_eAI_COMPONENT_TOO_SHORT, entry->ai, strlen(entry->ai), (int)(p-start) + (int)complen);
 			return 0;
 		}
 
-		// Run the cset linter
-		linter = part->cset == cset_N ? lint_csetNumeric : lint_cset82;
-		if (!linter(ctx, entry, compval))
+		if (!validateComponent(ctx, entry, part, p, complen, (int)(p-start)))
 			return 0;
 
-		// Run each additional linter on the component
-		for (j = 0; j < SIZEOF_ARRAY(ai_table[0].parts[0].linters); j++) {
-			if (!part->linters[j])
-				break;
-			if (!part->linters[j](ctx, entry, compval))
-				return 0;
-		}
+		p += complen;
 	}
 
 	return (size_t)(p-start);	// Amount of data that validation consumed
@@ -959,28 +625,24 @@ static size_t validate_ai_val(gs1_encoder *ctx, const struct aiEntry *entry, con
  */
 bool gs1_aiValLengthContentCheck(gs1_encoder *ctx, const struct aiEntry *entry, const char *aiVal, const size_t vallen) {
 
-	size_t i, minlen = 0, maxlen = 0;
+	const char *caret;
 
 	assert(ctx);
 	assert(entry);
 	assert(aiVal);
 
-	for (i = 0; i < SIZEOF_ARRAY(ai_table[0].parts); i++) {
-		minlen += entry->parts[i].min;
-		maxlen += entry->parts[i].max;
-	}
-	if (vallen < minlen) {
-		sprintf(ctx->errMsg, "AI (%s) value is too short", entry->ai);
+	if (vallen < entry->minLen) {
+		gs1_setError(ctx, gs1_encoder_eAI_VALUE_TOO_SHORT, entry->ai, strlen(entry->ai), (int)vallen);
 		return false;
 	}
-	if (vallen > maxlen) {
-		sprintf(ctx->errMsg, "AI (%s) value is too long", entry->ai);
+	if (vallen > entry->maxLen) {
+		gs1_setError(ctx, gs1_encoder_eAI_VALUE_TOO_LONG, entry->ai, strlen(entry->ai), entry->maxLen);
 		return false;
 	}
 
 	// Also forbid data "^" characters at this stage so we don't conflate with FNC1
-	if (memchr(aiVal, '^', vallen) != NULL) {
-		sprintf(ctx->errMsg, "AI (%s) contains illegal ^ character", entry->ai);
+	if ((caret = memchr(aiVal, '^', vallen)) != NULL) {
+		gs1_setError(ctx, gs1_encoder_eAI_ILLEGAL_CARET, entry->ai, strlen(entry->ai), (int)(caret - aiVal));
 		return false;
 	}
 
@@ -997,8 +659,8 @@ bool gs1_parseAIdata(gs1_encoder *ctx, const char *aiData, char *dataStr) {
 
 	const char *p, *r;
 	char *outai, *outval;
+	char *dataEnd = dataStr;			// Output cursor
 	uint8_t ailen;
-	size_t i;
 	bool fnc1req = true;
 	const struct aiEntry *entry;
 
@@ -1007,6 +669,7 @@ bool gs1_parseAIdata(gs1_encoder *ctx, const char *aiData, char *dataStr) {
 
 	*dataStr = '\0';
 	*ctx->errMsg = '\0';
+	ctx->errCode = gs1_encoder_eNONE;
 	ctx->errFlag = false;
 
 	DEBUG_PRINT("\nParsing AI data: %s\n", aiData);
@@ -1020,24 +683,21 @@ bool gs1_parseAIdata(gs1_encoder *ctx, const char *aiData, char *dataStr) {
 		ailen = (uint8_t)(r-p);
 		entry = gs1_lookupAIentry(ctx, p, (size_t)ailen);
 		if (entry == NULL) {
-			sprintf(ctx->errMsg, "Unrecognised AI: %.*s", ailen, p);
+			gs1_setError(ctx, gs1_encoder_eAI_UNRECOGNISED, p, ailen, -1);
 			goto fail;
 		}
 
 		if (fnc1req)
 			writeDataStr("^");			// Write FNC1, if required
-		outai = dataStr + strlen(dataStr);		// Record the current start of the output AI
+		outai = dataEnd;				// Record the current start of the output AI
 		nwriteDataStr(p, (size_t)ailen);		// Write AI
 
-		fnc1req = true;					// Determine whether FNC1 required before next AI
-		for (i = 0; i < SIZEOF_ARRAY(fixedAIprefixes); i++)
-			if (strncmp(fixedAIprefixes[i], p, 2) == 0)
-				fnc1req = false;
+		fnc1req = gs1_isFNC1required(p);		// Determine whether FNC1 required before next AI
 
 		r++;						// Advance to start of AI value
 		if (!*r) goto fail;				// Fail if message ends after AI and no value
 
-		outval = dataStr + strlen(dataStr);		// Record the current start of the output value
+		outval = dataEnd;				// Record the current start of the output value
 
 again:
 
@@ -1055,7 +715,7 @@ again:
 
 		// Perform certain checks at parse time, before processing the
 		// components with the linters
-		if (!gs1_aiValLengthContentCheck(ctx, entry, outval, strlen(outval)))
+		if (!gs1_aiValLengthContentCheck(ctx, entry, outval, (size_t)(dataEnd - outval)))
 			goto fail;
 
 		// Update the AI data
@@ -1064,10 +724,10 @@ again:
 			ctx->aiData[ctx->numAIs].ai = outai;
 			ctx->aiData[ctx->numAIs].ailen = ailen;
 			ctx->aiData[ctx->numAIs].value = outval;
-			ctx->aiData[ctx->numAIs].vallen = (uint8_t)strlen(outval);
+			ctx->aiData[ctx->numAIs].vallen = (uint8_t)(dataEnd - outval);
 			ctx->numAIs++;
 		} else {
-			strcpy(ctx->errMsg, "Too many AIs");
+			gs1_setError(ctx, gs1_encoder_eTOO_MANY_AIS, NULL, 0, -1);
 			goto fail;
 		}
 
@@ -1080,11 +740,115 @@ again:
 
 fail:
 
-	if (*ctx->errMsg == '\0')
-		strcpy(ctx->errMsg, "Failed to parse AI data");
-	ctx->errFlag = true;
+	if (ctx->errCode == gs1_encoder_eNONE)
+		gs1_setError(ctx, gs1_encoder_eAI_PARSE_FAILED, NULL, 0, -1);
+
+	DEBUG_PRINT("Parsing AI data failed: %s\n", gs1_encoder_getErrMsg(ctx));
+
+	*dataStr = '\0';
+	return false;
+
+}
+
+
+/*
+ *  Convert AIs that are given as separate values to regular AI data string
+ *  with ^ = FNC1, validating each value in place with the linters and
+ *  extracting the AIs as we go
+ *
+ *  An AI of NULL separates the linear and 2D components of a composite.
+ *
+ */
+bool gs1_writeAIs(gs1_encoder *ctx, const gs1_encoder_ai *ais, const size_t num, char *dataStr) {
+
+	const gs1_encoder_ai *in;
+	char *outai, *outval;
+	char *dataEnd = dataStr;			// Output cursor
+	size_t i, ailen, consumed;
+	bool fnc1req = true;
+	bool sepSeen = false;
+	const struct aiEntry *entry;
+
+	assert(ctx);
+	assert(ais || num == 0);
+
+	*dataStr = '\0';
+	*ctx->errMsg = '\0';
+	ctx->errCode = gs1_encoder_eNONE;
+	ctx->errFlag = false;
+
+	for (i = 0; i < num; i++) {
+
+		in = &ais[i];
+
+		if (in->ai == NULL) {			// Composite component separator
+			if (sepSeen || dataEnd == dataStr || i == num - 1) {
+				gs1_setError(ctx, sepSeen ? gs1_encoder_eAI_PARSE_FAILED : gs1_encoder_eAI_DATA_EMPTY, NULL, 0, -1);
+				goto fail;
+			}
+			if (ctx->numAIs >= MAX_AIS) {
+				gs1_setError(ctx, gs1_encoder_eTOO_MANY_AIS, NULL, 0, -1);
+				goto fail;
+			}
+			writeDataStr("|");
+			ctx->aiData[ctx->numAIs++].aiEntry = NULL;	// Indicate separator in HRI
+			fnc1req = true;
+			sepSeen = true;
+			continue;
+		}
+
+		assert(in->value || in->length == 0);
+
+		ailen = strlen(in->ai);
+		if (ailen < 2 || ailen > 4 || !gs1_allDigits((const uint8_t*)in->ai, ailen) ||
+		    (entry = gs1_lookupAIentry(ctx, in->ai, ailen)) == NULL) {
+			gs1_setError(ctx, gs1_encoder_eAI_UNRECOGNISED, in->ai, ailen, -1);
+			goto fail;
+		}
+
+		// Check the value before it is copied, then run the linters on it
+		if (!gs1_aiValLengthContentCheck(ctx, entry, in->value, in->length))
+			goto fail;
+		if ((consumed = validate_ai_val(ctx, entry, in->value, in->value + in->length)) == 0)
+			goto fail;
+		if (consumed != in->length) {
+			gs1_setError(ctx, gs1_encoder_eAI_DATA_TOO_LONG, entry->ai, strlen(entry->ai), (int)consumed);
+			goto fail;
+		}
 
-	DEBUG_PRINT("Parsing AI data failed: %s\n", ctx->errMsg);
+		if (ctx->numAIs >= MAX_AIS) {
+			gs1_setError(ctx, gs1_encoder_eTOO_MANY_AIS, NULL, 0, -1);
+			goto fail;
+		}
+
+		if (fnc1req)
+			writeDataStr("^");			// Write FNC1, if required
+		outai = dataEnd;
+		nwriteDataStr(in->ai, ailen);
+		fnc1req = gs1_isFNC1required(in->ai);
+		outval = dataEnd;
+		nwriteDataStr(in->value, in->length);
+
+		ctx->aiData[ctx->numAIs].aiEntry = entry;
+		ctx->aiData[ctx->numAIs].ai = outai;
+		ctx->aiData[ctx->numAIs].ailen = (uint8_t)ailen;
+		ctx->aiData[ctx->numAIs].value = outval;
+		ctx->aiData[ctx->numAIs].vallen = (uint8_t)in->length;
+		ctx->numAIs++;
+
+	}
+
+	if (dataEnd == dataStr) {
+		gs1_setError(ctx, gs1_encoder_eAI_DATA_EMPTY, NULL, 0, -1);
+		goto fail;
+	}
+
+	return true;
+
+fail:
+
+	if (ctx->errCode == gs1_encoder_eNONE)
+		gs1_setError(ctx, gs1_encoder_eAI_PARSE_FAILED, NULL, 0, -1);
 
 	*dataStr = '\0';
 	return false;
@@ -1098,29 +862,28 @@ fail:
  */
 bool gs1_processAIdata(gs1_encoder *ctx, const char *dataStr, const bool extractAIs) {
 
-	const char *p, *r, *ai;
-	size_t vallen;
+	const char *p, *r = NULL, *ai;
+	size_t ailen, vallen;
 	const struct aiEntry *entry;
 
 	assert(ctx);
 	assert(dataStr);
 
 	*ctx->errMsg = '\0';
+	ctx->errCode = gs1_encoder_eNONE;
 	ctx->errFlag = false;
 
 	p = dataStr;
 
 	// Ensure FNC1 in first
 	if (!*p || *p++ != '^') {
-		strcpy(ctx->errMsg, "Missing FNC1 in first position");
-		ctx->errFlag = true;
+		gs1_setError(ctx, gs1_encoder_eMISSING_FNC1_IN_FIRST, NULL, 0, -1);
 		return false;
 	}
 
 	// Must have some AI data
 	if (!*p) {
-		strcpy(ctx->errMsg, "The AI data is empty");
-		ctx->errFlag = true;
+		gs1_setError(ctx, gs1_encoder_eAI_DATA_EMPTY, NULL, 0, -1);
 		return false;
 	}
 
@@ -1136,18 +899,21 @@ bool gs1_processAIdata(gs1_encoder *ctx, const char *dataStr, const bool extract
 		 */
 		if ((entry = gs1_lookupAIentry(ctx, p, 0)) == NULL ||
 		    (extractAIs && entry == &unknownAI)) {
-			sprintf(ctx->errMsg, "No known AI is a prefix of: %.4s...", p);
-			ctx->errFlag = true;
+			gs1_setError(ctx, gs1_encoder_eAI_NO_KNOWN_PREFIX, p, strnlen(p, 4), -1);
 			return false;
 		}
 
 		// Save start of AI for AI data then jump over
 		ai = p;
-		p += strlen(entry->ai);
-
-		// r points to the next FNC1 or end of string...
-		if ((r = strchr(p, '^')) == NULL)
-			r = p + strlen(p);
+		ailen = strlen(entry->ai);
+		p += ailen;
+
+		// r points to the next FNC1 or end of string, which is shared by
+		// any run of AIs that do not require FNC1
+		if (r == NULL || r < p) {
+			if ((r = strchr(p, '^')) == NULL)
+				r = p + strlen(p);
+		}
 
 		// Validate and return how much was consumed
 		if ((vallen = validate_ai_val(ctx, entry, p, r)) == 0)
@@ -1158,13 +924,12 @@ bool gs1_processAIdata(gs1_encoder *ctx, const char *dataStr, const bool extract
 			if (ctx->numAIs < MAX_AIS) {
 				ctx->aiData[ctx->numAIs].aiEntry = entry;
 				ctx->aiData[ctx->numAIs].ai = ai;
-				ctx->aiData[ctx->numAIs].ailen = (uint8_t)strlen(entry->ai);
+				ctx->aiData[ctx->numAIs].ailen = (uint8_t)ailen;
 				ctx->aiData[ctx->numAIs].value = p;
 				ctx->aiData[ctx->numAIs].vallen = (uint8_t)vallen;
 				ctx->numAIs++;
 			} else {
-				strcpy(ctx->errMsg, "Too many AIs");
-				ctx->errFlag = true;
+				gs1_setError(ctx, gs1_encoder_eTOO_MANY_AIS, NULL, 0, -1);
 				return false;
 			}
 		}
@@ -1172,8 +937,7 @@ bool gs1_processAIdata(gs1_encoder *ctx, const char *dataStr, const bool extract
 		// After AIs requiring FNC1, we expect to find an FNC1 or be at the end
 		p += vallen;
 		if (entry->fnc1 && *p != '^' && *p != '\0') {
-			sprintf(ctx->errMsg, "AI (%s) data is too long", entry->ai);
-			ctx->errFlag = true;
+			gs1_setError(ctx, gs1_encoder_eAI_DATA_TOO_LONG, entry->ai, strlen(entry->ai), (int)vallen);
 			return false;
 		}
 
@@ -1188,43 +952,246 @@ bool gs1_processAIdata(gs1_encoder *ctx, const char *dataStr, const bool extract
 }
 
 
+/*
+ *  Find the association rules of an AI, given its length
+ *
+ */
+static const struct aiAssoc* lookupAssoc(const gs1_encoder *ctx, const char *ai, const size_t ailen) {
+
+	size_t lo = 0, hi = ctx->aiAssocSize, mid;
+	const struct aiAssoc *assoc;
+	int cmp;
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		assoc = &ctx->aiAssoc[mid];
+		if ((cmp = strncmp(ai, assoc->ai, ailen)) == 0)
+			cmp = assoc->ai[ailen] == '\0' ? 0 : -1;
+		if (cmp == 0)
+			return assoc;
+		if (cmp < 0)
+			hi = mid;
+		else
+			lo = mid + 1;
+	}
+
+	return NULL;
+
+}
+
+
+static const char* assocBitAI(const gs1_encoder *ctx, const int bit) {
+
+	size_t i;
+
+	for (i = 0; i < ctx->aiAssocSize; i++)
+		if (ctx->aiAssoc[i].bit == bit)
+			return ctx->aiAssoc[i].ai;
+
+	assert(false);
+	return "";
+
+}
+
+
+/*
+ *  Check the extracted AIs against the association rules: every requisite
+ *  of an AI must be met by some AI in the message and no AI that it excludes
+ *  may be present.
+ *
+ *  The AIs of the message are first gathered into a set so that each rule is
+ *  then a single mask test.
+ *
+ */
+bool gs1_validateAIassociations(gs1_encoder *ctx) {
+
+	const struct aiAssoc *assocs[MAX_AIS];
+	const struct aiAssoc *assoc;
+	const struct aiValue *aiv;
+	uint32_t present = 0, clash;
+	int i, j, bit;
+
+	assert(ctx);
+	assert(ctx->numAIs <= MAX_AIS);
+
+	// The primary message of a composite symbol with an EAN/UPC linear
+	// component is a GTIN
+	if (*ctx->dataStr != '^' && strchr(ctx->dataStr, '|') != NULL) {
+		assoc = lookupAssoc(ctx, "01", 2);
+		if (assoc && assoc->bit != NO_ASSOC_BIT)
+			present |= (uint32_t)1 << assoc->bit;
+	}
+
+	for (i = 0; i < ctx->numAIs; i++) {
+		aiv = &ctx->aiData[i];
+		assocs[i] = aiv->aiEntry ? lookupAssoc(ctx, aiv->ai, aiv->ailen) : NULL;	// NULL is the composite separator
+		if (assocs[i] && assocs[i]->bit != NO_ASSOC_BIT)
+			present |= (uint32_t)1 << assocs[i]->bit;
+	}
+
+	for (i = 0; i < ctx->numAIs; i++) {
+		if ((assoc = assocs[i]) == NULL)
+			continue;
+		aiv = &ctx->aiData[i];
+
+		if ((clash = assoc->ex & present) != 0) {
+			for (bit = 0; !(clash & 1); bit++)
+				clash >>= 1;
+			gs1_setError(ctx, gs1_encoder_eAI_INVALID_PAIR, aiv->ai, aiv->ailen, -1);
+			strcpy(ctx->errPairAI, assocBitAI(ctx, bit));
+			return false;
+		}
+
+		for (j = 0; j < MAX_ASSOC_REQS; j++) {
+			if (assoc->req[j] != 0 && (assoc->req[j] & present) == 0) {
+				gs1_setError(ctx, gs1_encoder_eAI_REQUISITE_MISSING, aiv->ai, aiv->ailen, -1);
+				return false;
+			}
+		}
+	}
+
+	return true;
+
+}
+
+
+/*
+ *  Mod-10 check digit for a run of digits that excludes the check digit, or
+ *  -1 if any character is not a digit
+ *
+ *  Digits are weighted 3 and 1 alternately from the right. Eight digits are
+ *  processed at a time as the bytes of a word, with alternate bytes masked
+ *  into two sets of 16-bit lanes that are each summed by a multiplication.
+ *
+ */
+int gs1_checkDigit(const uint8_t *str, const size_t len) {
+
+	size_t i = 0;
+	uint64_t w;
+	uint32_t sum3 = 0, sum1 = 0, even, odd;
+	const uint16_t one = 1;
+	uint8_t lsb;
+	bool evenWeight3;
+
+	assert(str);
+
+	// Weight 3 falls on the even bytes of each word when the length is odd,
+	// with the bytes in reverse order on big-endian platforms
+	memcpy(&lsb, &one, 1);
+	evenWeight3 = (len % 2 == 1) == (lsb == 1);
+
+	for (; i + 8 <= len; i += 8) {
+		memcpy(&w, str + i, sizeof(w));
+		if ((w & UINT64_C(0xF0F0F0F0F0F0F0F0)) != UINT64_C(0x3030303030303030) ||
+		    (((w & UINT64_C(0x0F0F0F0F0F0F0F0F)) + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)))
+			return -1;
+		even = (uint32_t)(((w & UINT64_C(0x000F000F000F000F)) * UINT64_C(0x0001000100010001)) >> 48);
+		odd = (uint32_t)((((w >> 8) & UINT64_C(0x000F000F000F000F)) * UINT64_C(0x0001000100010001)) >> 48);
+		sum3 += evenWeight3 ? even : odd;
+		sum1 += evenWeight3 ? odd : even;
+	}
+
+	for (; i < len; i++) {
+		if (str[i] < '0' || str[i] > '9')
+			return -1;
+		if ((len - i) % 2 == 1)
+			sum3 += (uint32_t)(str[i] - '0');
+		else
+			sum1 += (uint32_t)(str[i] - '0');
+	}
+
+	return (int)((10 - (3 * sum3 + sum1) % 10) % 10);
+
+}
+
+
 // Validate and set the parity digit
 bool gs1_validateParity(uint8_t *str) {
 
-	int weight;
-	int parity = 0;
+	size_t len;
+	int parity;
 
 	assert(*str);
 
-	weight = strlen((char*)str) % 2 == 0 ? 3 : 1;
-	while (*(str+1)) {
-		parity += weight * (*str++ - '0');
-		weight = 4 - weight;
-	}
-	parity = (10 - parity%10) % 10;
+	len = strlen((char*)str);
+	if ((parity = gs1_checkDigit(str, len - 1)) < 0)
+		return false;
 
-	if (parity + '0' == *str) return true;
+	if (parity + '0' == str[len - 1]) return true;
 
-	*str = (uint8_t)(parity + '0');		// Recalculate
+	str[len - 1] = (uint8_t)(parity + '0');		// Recalculate
 	return false;
 
 }
 
 
-bool gs1_allDigits(const uint8_t *str, size_t len) {
+/*
+ *  Length of the initial run of characters that are all within a class
+ *
+ *  Characters are classified eight at a time, combining their table entries so
+ *  that there is a single test for each group.
+ *
+ */
+size_t gs1_spanClass(const uint8_t *str, const size_t len, const uint8_t cls) {
 
-	size_t i;
+	size_t i = 0;
+
+	assert(str);
+
+	for (; i + 8 <= len; i += 8) {
+		if (!(gs1_charClass[str[i]]   & gs1_charClass[str[i+1]] &
+		      gs1_charClass[str[i+2]] & gs1_charClass[str[i+3]] &
+		      gs1_charClass[str[i+4]] & gs1_charClass[str[i+5]] &
+		      gs1_charClass[str[i+6]] & gs1_charClass[str[i+7]] & cls))
+			break;
+	}
+	for (; i < len; i++) {
+		if (!(gs1_charClass[str[i]] & cls))
+			break;
+	}
+	return i;
+
+}
+
+
+/*
+ *  Length of the initial run of digits
+ *
+ *  Eight characters are tested at a time as the bytes of a word: each must
+ *  have a high nibble of 3 and a low nibble that does not carry when 6 is
+ *  added. This is independent of byte order.
+ *
+ */
+size_t gs1_spanDigits(const uint8_t *str, const size_t len) {
+
+	size_t i = 0;
+	uint64_t w;
+
+	assert(str);
+
+	for (; i + 8 <= len; i += 8) {
+		memcpy(&w, str + i, sizeof(w));
+		if ((w & UINT64_C(0xF0F0F0F0F0F0F0F0)) != UINT64_C(0x3030303030303030) ||
+		    (((w & UINT64_C(0x0F0F0F0F0F0F0F0F)) + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)))
+			break;
+	}
+	for (; i < len; i++) {
+		if (!(gs1_charClass[str[i]] & CC_DIGIT))
+			break;
+	}
+	return i;
+
+}
+
+
+bool gs1_allDigits(const uint8_t *str, size_t len) {
 
 	assert(str);
 
 	if (!len)
 		len = strlen((char *)str);
 
-	for (i = 0; i < len; i++) {
-		if (str[i] < '0' || str[i] >'9')
-			return false;
-	}
-	return true;
+	return gs1_spanDigits(str, len) == len;
 
 }
 
@@ -1277,6 +1244,62 @@ void test_ai_lookupAIentry(void) {
 	TEST_CHECK(gs1_lookupAIentry(ctx, "2367", 4) == NULL);				// Don't vivify (2367) since AI prefix "23" is defined as having length 3
 	TEST_CHECK(gs1_lookupAIentry(ctx, "236", 3) == &unknownAI3);			// So (236) is okay
 
+	TEST_CHECK(gs1_lookupAIentry(ctx, "01", 2)->dlPkey);				// Generated attributes
+	TEST_CHECK(gs1_lookupAIentry(ctx, "8013", 4)->dlPkey);
+	TEST_CHECK(!gs1_lookupAIentry(ctx, "10", 2)->dlPkey);
+	TEST_CHECK(gs1_lookupAIentry(ctx, "253", 3)->minLen == 13);
+	TEST_CHECK(gs1_lookupAIentry(ctx, "253", 3)->maxLen == 30);
+	TEST_CHECK(gs1_lookupAIentry(ctx, "8003", 4)->minLen == 14);
+	TEST_CHECK(gs1_lookupAIentry(ctx, "8003", 4)->maxLen == 30);
+
+	gs1_encoder_free(ctx);
+
+}
+
+// Reference lookup by walking the whole AI table
+static const struct aiEntry* lookupAIentryByWalk(const char *p, size_t ailen) {
+
+	size_t i, entrylen;
+
+	for (i = 0; i < SIZEOF_ARRAY(ai_table); i++) {
+		entrylen = strlen(ai_table[i].ai);
+		if (strncmp(p, ai_table[i].ai, entrylen) == 0)
+			return ailen != 0 && entrylen != ailen ? NULL : &ai_table[i];
+		if (ailen != 0 && strncmp(p, ai_table[i].ai, ailen) == 0)
+			return NULL;
+	}
+
+	return &unknownAI;	// Stands for any unknown AI
+
+}
+
+void test_ai_lookupAIindex(void) {
+
+	gs1_encoder* ctx = gs1_encoder_init(NULL);
+	const struct aiEntry *expect, *entry;
+	char p[8];
+	int n, len;
+	size_t ailen;
+
+	// Every AI-like string, with and without following data, matches a table walk
+	for (len = 2; len <= 4; len++) {
+		for (n = 0; n < (len == 2 ? 100 : len == 3 ? 1000 : 10000); n++) {
+			sprintf(p, "%0*d", len, n);
+			strcat(p, len < 4 ? "X1" : "1");
+			for (ailen = 0; ailen <= (size_t)len; ailen++) {
+				expect = lookupAIentryByWalk(p, ailen);
+				ctx->permitUnknownAIs = false;
+				entry = gs1_lookupAIentry(ctx, p, ailen);
+				TEST_CHECK(ailen == 1 ? entry == NULL : entry == (expect == &unknownAI ? NULL : expect));
+				TEST_MSG("%s, %d", p, (int)ailen);
+				ctx->permitUnknownAIs = true;
+				entry = gs1_lookupAIentry(ctx, p, ailen);
+				TEST_CHECK(expect == &unknownAI || ailen == 1 ? entry == NULL || strcmp(entry->title, "UNKNOWN") == 0 : entry == expect);
+				TEST_MSG("%s, %d", p, (int)ailen);
+			}
+		}
+	}
+
 	gs1_encoder_free(ctx);
 
 }
@@ -1297,6 +1320,9 @@ static void test_parseAIdata(gs1_encoder *ctx, const bool should_succeed, const
 
 	char out[256];
 	char casename[256];
+	const struct aiValue *ai;
+	const char *p;
+	int i;
 
 	sprintf(casename, "%s => %s", aiData, expect);
 	TEST_CASE(casename);
@@ -1305,7 +1331,18 @@ static void test_parseAIdata(gs1_encoder *ctx, const bool should_succeed, const
 	TEST_CHECK(gs1_parseAIdata(ctx, aiData, out) ^ !should_succeed);
 	if (should_succeed)
 		TEST_CHECK(strcmp(out, expect) == 0);
-	TEST_MSG("Given: %s; Got: %s; Expected: %s; Err: %s", aiData, out, expect, ctx->errMsg);
+	TEST_MSG("Given: %s; Got: %s; Expected: %s; Err: %s", aiData, out, expect, gs1_encoder_getErrMsg(ctx));
+
+	// The extracted AIs tile the output, separated only by FNC1
+	for (i = 0, p = out; should_succeed && i < ctx->numAIs; i++) {
+		ai = &ctx->aiData[i];
+		if (*p == '^')
+			p++;
+		TEST_CHECK(ai->ai == p);
+		TEST_CHECK(ai->value == ai->ai + ai->ailen);
+		p = ai->value + ai->vallen;
+	}
+	TEST_CHECK(!should_succeed || *p == '\0');
 
 }
 
@@ -1360,7 +1397,7 @@ static void test_processAIdata(gs1_encoder *ctx, const bool should_succeed, cons
 
 	// Process and extract AIs
 	TEST_CHECK(gs1_processAIdata(ctx, dataStr, true) ^ !should_succeed);
-	TEST_MSG(ctx->errMsg);
+	TEST_MSG(gs1_encoder_getErrMsg(ctx));
 
 }
 
@@ -1428,6 +1465,11 @@ void test_ai_processAIdata(void) {
 	test_processAIdata(ctx, true,  "^7230123");					// Shortest
 	test_processAIdata(ctx, false, "^723012");					// Too short
 
+	test_processAIdata(ctx, true,  "^8010AZ09#-/");					// C1..30; FNC1 required
+	test_processAIdata(ctx, true,  "^8010ABC123^0112345678901231");
+	test_processAIdata(ctx, false, "^8010ABc123");					// Bad CSET39 character (lower case)
+	test_processAIdata(ctx, false, "^8010ABC!23");					// Bad CSET39 character (CSET82 only)
+
 	// Unlike parsed data input, we cannot vivify unknown AIs when
 	// extracting AI data from a raw string
 	gs1_encoder_setPermitUnknownAIs(ctx, true);
@@ -1474,7 +1516,7 @@ static void test_csumalpha(gs1_encoder *ctx, const struct aiEntry* entry, const
 	strcpy(casename, val);
 	TEST_CASE(casename);
 
-	TEST_CHECK(lint_csumalpha(ctx, entry, val) ^ !should_succeed);;
+	TEST_CHECK(lint_csumalpha(ctx, entry, val, strlen(val), 0) ^ !should_succeed);
 
 }
 
@@ -1519,5 +1561,143 @@ void test_ai_lint_csumalpha(void) {
 }
 
 
+void test_ai_charClass(void) {
+
+	static const char *cset82 = "!\"%&'()*+,-./0123456789:;<=>?ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz";
+	static const char *uri = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~:/?#[]@!$&'()*+,;=%";
+	static const char *cset39 = "#-/0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+	uint8_t str[40];
+	size_t len, pos;
+	int c;
+
+	for (c = 1; c < 256; c++) {
+		TEST_CHECK(!!(gs1_charClass[c] & CC_DIGIT) == (c >= '0' && c <= '9'));
+		TEST_CHECK(!!(gs1_charClass[c] & CC_CSET82) == (strchr(cset82, c) != NULL));
+		TEST_CHECK(!!(gs1_charClass[c] & CC_URI) == (strchr(uri, c) != NULL));
+		TEST_CHECK(!!(gs1_charClass[c] & CC_CSET39) == (strchr(cset39, c) != NULL));
+	}
+	TEST_CHECK(gs1_charClass[0] == 0);
+
+	// Every character at every position within and after whole words
+	for (len = 0; len <= sizeof(str); len++) {
+		for (pos = 0; pos < len; pos++) {
+			for (c = 0; c < 256; c++) {
+				memset(str, '5', sizeof(str));
+				str[pos] = (uint8_t)c;
+				TEST_CHECK(gs1_spanDigits(str, len) == (c >= '0' && c <= '9' ? len : pos));
+				TEST_CHECK(gs1_spanClass(str, len, CC_CSET82) == (gs1_charClass[c] & CC_CSET82 ? len : pos));
+				TEST_CHECK(gs1_spanClass(str, len, CC_URI) == (gs1_charClass[c] & CC_URI ? len : pos));
+				TEST_CHECK(gs1_spanClass(str, len, CC_CSET39) == (gs1_charClass[c] & CC_CSET39 ? len : pos));
+			}
+		}
+	}
+
+	TEST_CHECK(gs1_allDigits((const uint8_t*)"0123456789", 0));
+	TEST_CHECK(!gs1_allDigits((const uint8_t*)"0123456789:", 0));
+	TEST_CHECK(gs1_allDigits((const uint8_t*)"0123X", 4));
+
+}
+
+
+static void test_validateComponent(gs1_encoder *ctx, const uint8_t cset, const uint8_t linter, const char *val, const char *expect) {
+
+	struct aiEntry entry = { .ai = "99" };
+	const struct aiComponent part = { .cset = cset, .min = 0, .max = 90, .linters[0] = linter };
+	char casename[256];
+
+	sprintf(casename, "%d,%d: %s", cset, linter, val);
+	TEST_CASE(casename);
+
+	ctx->errMsg[0] = '\0';
+	ctx->errCode = gs1_encoder_eNONE;
+	ctx->errFlag = false;
+	TEST_CHECK(validateComponent(ctx, &entry, &part, val, strlen(val), 0) ^ (*expect != '\0'));
+	TEST_CHECK(strstr(gs1_encoder_getErrMsg(ctx), expect) != NULL);
+	TEST_MSG("Got: %s", gs1_encoder_getErrMsg(ctx));
+
+}
+
+void test_ai_validateComponent(void) {
+
+	gs1_encoder* ctx = gs1_encoder_init(NULL);
+
+	// Fused operations
+	test_validateComponent(ctx, cset_X, linter_none, "ABC!xyz_", "");
+	test_validateComponent(ctx, cset_X, linter_none, "ABC~", "Incorrect CSET 82 character");
+	test_validateComponent(ctx, cset_X, linter_csumalpha, "1987654Ad4X4bL5ttr2310c2K", "");
+	test_validateComponent(ctx, cset_X, linter_csumalpha, "1987654Ad4X4bL5ttr2310c2L", "Bad alphanumeric check characters");
+	test_validateComponent(ctx, cset_X, linter_csumalpha, "1987654Ad4X4bL5ttr2310c~K", "Incorrect CSET 82 character");
+	test_validateComponent(ctx, cset_X, linter_csumalpha, "A", "Alphanumeric string is too short to check");
+	test_validateComponent(ctx, cset_N, linter_none, "0123456789", "");
+	test_validateComponent(ctx, cset_N, linter_none, "01234A", "Illegal non-digit character");
+	test_validateComponent(ctx, cset_N, linter_csum, "12345678901231", "");
+	test_validateComponent(ctx, cset_N, linter_csum, "12345678901234", "Incorrect check digit");
+	test_validateComponent(ctx, cset_N, linter_csum, "1234567890123A", "Illegal non-digit character");
+	test_validateComponent(ctx, cset_N, linter_csum, "A2345678901234", "Illegal non-digit character");
+	test_validateComponent(ctx, cset_N, linter_csum, "0", "");
+	test_validateComponent(ctx, cset_C, linter_none, "AZ09#-/", "");
+	test_validateComponent(ctx, cset_C, linter_none, "AZ09#-/a", "Incorrect CSET 39 character");
+	test_validateComponent(ctx, cset_C, linter_none, "AZ09!", "Incorrect CSET 39 character");
+
+	// Character set check followed by the linter function
+	test_validateComponent(ctx, cset_X, linter_csum, "12345678901231", "");
+	test_validateComponent(ctx, cset_X, linter_csum, "1234567890123A", "Incorrect check digit");
+	test_validateComponent(ctx, cset_X, linter_csum, "1234567890123~", "Incorrect CSET 82 character");
+	test_validateComponent(ctx, cset_X, linter_csum, "1A/", "Incorrect check digit");
+	test_validateComponent(ctx, cset_N, linter_csumalpha, "0000022", "Bad alphanumeric check characters");
+	test_validateComponent(ctx, cset_N, linter_csumalpha, "00000!H", "Illegal non-digit character");
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+static void test_validateAIassociations(gs1_encoder *ctx, const bool should_succeed, const char *dataStr, const char *errMsg) {
+
+	char casename[256];
+
+	sprintf(casename, "%s", dataStr);
+	TEST_CASE(casename);
+
+	strcpy(ctx->dataStr, dataStr);
+	ctx->numAIs = 0;
+	TEST_ASSERT(gs1_processAIdata(ctx, ctx->dataStr, true));
+	TEST_CHECK(gs1_validateAIassociations(ctx) ^ !should_succeed);
+	TEST_CHECK(strcmp(gs1_encoder_getErrMsg(ctx), errMsg) == 0);
+	TEST_MSG("Got: %s; Expected: %s", gs1_encoder_getErrMsg(ctx), errMsg);
+
+}
+
+void test_ai_validateAIassociations(void) {
+
+	gs1_encoder* ctx = gs1_encoder_init(NULL);
+	size_t i;
+
+	// The table is sorted for lookup
+	for (i = 1; i < SIZEOF_ARRAY(ai_assoc); i++)
+		TEST_CHECK(strcmp(ai_assoc[i-1].ai, ai_assoc[i].ai) < 0);
+
+	TEST_CHECK(lookupAssoc(ctx, "01", 2) != NULL);
+	TEST_CHECK(lookupAssoc(ctx, "3103", 4) != NULL);
+	TEST_CHECK(lookupAssoc(ctx, "310", 3) == NULL);
+	TEST_CHECK(lookupAssoc(ctx, "99", 2) == NULL);
+
+	test_validateAIassociations(ctx, true,  "^0112345678901231", "");
+	test_validateAIassociations(ctx, true,  "^0112345678901231^10ABC^21XYZ", "");
+	test_validateAIassociations(ctx, true,  "^99ABC", "");
+	test_validateAIassociations(ctx, false, "^10ABC", "Required AIs for AI (10) are not satisfied");
+	test_validateAIassociations(ctx, true,  "^10ABC^0212345678901231^375", "");
+	test_validateAIassociations(ctx, false, "^0212345678901231", "Required AIs for AI (02) are not satisfied");
+	test_validateAIassociations(ctx, false, "^0112345678901231^0212345678901231^375", "It is invalid to pair AI (01) with AI (02)");
+	test_validateAIassociations(ctx, false, "^0112345678901231^21ABC^235XYZ", "It is invalid to pair AI (21) with AI (235)");
+	test_validateAIassociations(ctx, true,  "^0112345678901231^21ABC^250XYZ", "");
+	test_validateAIassociations(ctx, false, "^0112345678901231^250XYZ", "Required AIs for AI (250) are not satisfied");
+	test_validateAIassociations(ctx, true,  "^3103000123^0212345678901231^375", "");
+
+	gs1_encoder_free(ctx);
+
+}
+
+
 #endif  /* UNIT_TESTS */
 
@@ -28,6 +28,17 @@
 
 #define MAX_AIS		64
 #define MAX_AI_LEN	90
+#define AI_INDEX_KEYS	1000	// Groups of AIs sharing their first three digits
+#define MAX_AI_TITLE	34
+#define MAX_ASSOC_REQS	2	// Requisite rules per AI
+#define NO_ASSOC_BIT	0xFF
+
+
+// Character classes, as bits of gs1_charClass[]
+#define CC_DIGIT	0x01
+#define CC_CSET82	0x02
+#define CC_URI		0x04
+#define CC_CSET39	0x08
 
 
 typedef enum {
@@ -38,25 +49,55 @@ typedef enum {
 } cset_t;
 
 
+typedef enum {
+	linter_none = 0,
+	linter_csum,
+	linter_csumalpha,
+	NUM_LINTERS,
+} linterId_t;
+
+
 struct aiEntry;		// Must forward declare
 
-typedef bool (*linter_t)(gs1_encoder *ctx, const struct aiEntry *entry, char *val);
+typedef bool (*linter_t)(gs1_encoder *ctx, const struct aiEntry *entry, const char *val, const size_t len, const int offset);
 
 
+/*
+ *  AI table entries hold no pointers and consist only of bytes so that a
+ *  compiled syntax dictionary file can be loaded and used as it is
+ *
+ */
+
 // A single AI may consist of multiple concatenated components
 struct aiComponent {
-	cset_t cset;
+	uint8_t cset;		// cset_t
 	uint8_t min;
 	uint8_t max;
-	linter_t linters[1];
+	uint8_t linters[1];	// linterId_t
 };
 
 
 struct aiEntry {
-	char *ai;
-	bool fnc1;
+	char ai[5];
+	uint8_t fnc1;
+	uint8_t dlPkey;		// Digital Link primary key
+	uint8_t minLen;		// Total length of the components
+	uint8_t maxLen;
 	struct aiComponent parts[5];
-	const char *title;
+	char title[MAX_AI_TITLE+1];
+};
+
+/*
+ *  Association rules of an AI, as sets of the AIs that are referred to by any
+ *  rule, each of which is given a bit. Like the AI table entries these hold no
+ *  pointers, so that they are loaded with a compiled syntax dictionary.
+ *
+ */
+struct aiAssoc {
+	char ai[5];
+	uint8_t bit;			// Bit of this AI within a set, or NO_ASSOC_BIT
+	uint32_t ex;			// AIs that must not accompany this AI
+	uint32_t req[MAX_ASSOC_REQS];	// Each requires any one of its AIs
 };
 
 struct aiValue {
@@ -68,40 +109,54 @@ struct aiValue {
 };
 
 
-// Write to unbracketed AI dataStr checking for overflow
-#define writeDataStr(v) do {						\
-	if (strlen(dataStr) + strlen(v) > MAX_DATA)			\
-		goto fail;						\
-	strcat(dataStr, v);						\
-} while (0)
-
+/*
+ *  Write to unbracketed AI dataStr at the output cursor dataEnd, checking for
+ *  overflow and keeping the output terminated
+ *
+ */
 #define nwriteDataStr(v,l) do {						\
-	if (strlen(dataStr) + l > MAX_DATA)				\
+	if ((size_t)(dataEnd - dataStr) + (l) > MAX_DATA)		\
 		goto fail;						\
-	strncat(dataStr, v, l);						\
+	memcpy(dataEnd, v, l);						\
+	dataEnd += (l);							\
+	*dataEnd = '\0';						\
 } while (0)
 
+#define writeDataStr(v) nwriteDataStr(v, strlen(v))
+
 
 #include "gs1encoders.h"
 
+extern const uint8_t gs1_charClass[256];
+
+void gs1_setBuiltinAItable(gs1_encoder *ctx);
 const struct aiEntry* gs1_lookupAIentry(gs1_encoder *ctx, const char *p, size_t ailen);
 bool gs1_isFNC1required(const char *ai);
 uint8_t gs1_aiLengthByPrefix(const char *ai);
 bool gs1_aiValLengthContentCheck(gs1_encoder *ctx, const struct aiEntry *entry, const char *aiVal, size_t vallen);
 bool gs1_parseAIdata(gs1_encoder *ctx, const char *aiData, char *dataStr);
+bool gs1_writeAIs(gs1_encoder *ctx, const gs1_encoder_ai *ais, size_t num, char *dataStr);
 bool gs1_processAIdata(gs1_encoder *ctx, const char *dataStr, bool extractAIs);
+bool gs1_validateAIassociations(gs1_encoder *ctx);
+int gs1_checkDigit(const uint8_t *str, size_t len);
 bool gs1_validateParity(uint8_t *str);
 bool gs1_allDigits(const uint8_t *str, size_t len);
+size_t gs1_spanClass(const uint8_t *str, size_t len, uint8_t cls);
+size_t gs1_spanDigits(const uint8_t *str, size_t len);
 
 
 #ifdef UNIT_TESTS
 
 void test_ai_lookupAIentry(void);
+void test_ai_lookupAIindex(void);
 void test_ai_AItableVsPrefixLength(void);
 void test_ai_parseAIdata(void);
 void test_ai_processAIdata(void);
 void test_ai_validateParity(void);
 void test_ai_lint_csumalpha(void);
+void test_ai_validateComponent(void);
+void test_ai_charClass(void);
+void test_ai_validateAIassociations(void);
 
 #endif
 
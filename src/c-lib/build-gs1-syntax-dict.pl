@@ -1,11 +1,52 @@
 #!/usr/bin/perl -Tw
 
 #
-#  cat gs1-format-spec.txt | ./build-gs1-syntax-dict.pl
+#  cat gs1-format-spec.txt | ./build-gs1-syntax-dict.pl > ai-table.h
+#
+#  Generates the AI table and its lookup index, and the table of AI
+#  association rules, that are included by ai.c
+#
+#  cat gs1-format-spec.txt | ./build-gs1-syntax-dict.pl --binary > gs1-syntax-dict.bin
+#
+#  Generates a compiled syntax dictionary that can be loaded at runtime with
+#  gs1_encoder_setSyntaxDictionary(). The layout must match struct
+#  syntaxDictHeader, struct aiEntry and struct aiAssoc, and is written in the
+#  byte order of the build platform.
 #
 
 use strict;
 
+# Linters that are implemented by ai.c, with their linterId_t values
+my %linters = (csum => 1, csumalpha => 2);
+
+# cset_t values
+my %csets = (X => 1, N => 2, C => 3);
+
+# Must agree with syntaxdict.h and ai.h
+my $dict_magic = 'GS1D';
+my $dict_version = 2;
+my $dict_byte_order = 0x0102;
+my $entry_size = 64;
+my $assoc_size = 20;
+my $max_title = 34;
+
+# Must agree with ai.h
+my $max_assoc_reqs = 2;
+my $max_assoc_bits = 32;
+
+my $binary = @ARGV && $ARGV[0] eq '--binary' ? shift @ARGV : '';
+
+# Number of groups of AIs sharing their first three digits, as AI_INDEX_KEYS
+my $index_keys = 1000;
+
+my @entries;
+my @binentries;
+my @keys;
+my $lastai = '';
+my %ais;
+my %reqs;
+my %exs;
+
 my $ai_rx = qr/
     (
         (0\d)
@@ -86,17 +127,20 @@ while (<>) {
     my $ais = $+{ais};
     my $flags = $+{flags} || '';
     my $spec = $+{spec};
-    my $keyvals = $+{keyvals} || '';  # ignored
+    my $keyvals = $+{keyvals} || '';
     my $title = $+{title} || '';
 
     my @elms = split(/\s+/, $spec, 5);
     $#elms = 4;
 
     my $specstr = '';
+    my @parts;
+    my ($minlen, $maxlen) = (0, 0);
     foreach (@elms) {
 
         if (!defined($_)) {
             $specstr .= ' __,';
+            push @parts, 0, 0, 0, 0;
             next;
         }
 
@@ -107,17 +151,15 @@ while (<>) {
         $len = "$len..$len" if $len !~ /\./;
         (my $min, my $max) = $len =~ /^(\d+)\.\.(\d+)$/;
 
-        $checks=$checks || '';
-        my @checks=split(',', $checks, 2);
-        $#checks = 0;
-        $checks='';
-        foreach (@checks) {
-            $_ = '_' unless (defined $_ && $_ eq 'csum');   # csum only for the moment
-            $checks .= "$_,";
-        }
-        $checks =~ s/^\s+|\s+$//g;
+        # Only the first linter that is implemented is applied
+        $checks = $checks || '';
+        my ($linter) = grep { $linters{$_} } split(',', $checks);
+        $linter = '_' unless defined $linter;
 
-        $specstr .= " $cset,$min,$max,$checks";
+        $specstr .= " $cset,$min,$max,$linter,";
+        push @parts, $csets{$cset}, $min, $max, $linter eq '_' ? 0 : $linters{$linter};
+        $minlen += $min;
+        $maxlen += $max;
 
     }
 
@@ -126,15 +168,128 @@ while (<>) {
 
     my $fnc1 = $flags =~ /\*/ ? 'NO_FNC1' : 'FNC1   ';
 
+    my $dlpkey = $keyvals =~ /(^|\s)dlpkey(=|\s|$)/ ? 'DL_PKEY   ' : 'NO_DL_PKEY';
+    my $isdlpkey = $dlpkey =~ /^DL/ ? 1 : 0;
+
+    # Association rules: each "req" lists alternatives, one of which must be
+    # present; "ex" lists the AIs that must not be present
+    my @req = map { [ split(',', $_) ] } $keyvals =~ /(?:^|\s)req=(\S+)/g;
+    my @ex = map { split(',', $_) } $keyvals =~ /(?:^|\s)ex=(\S+)/g;
+    die "Too many requisites for AI $ais" if @req > $max_assoc_reqs;
+
     $specstr = sprintf("%-46s", $specstr);
 
     $title =~ s/²/^2/;
     $title =~ s/³/^3/;
+    die "Title for AI $ais is too long" if length($title) > $max_title;
+    my $rawtitle = $title;
     $title = sprintf("%-27s", "\"$title\"");
 
     for ($aimin..$aimax) {
-        $_ = sprintf('%-6s', "\"$_\"");
-        print "AI( $_, $fnc1,$specstr$title ),\n";
+
+        # Lookups rely upon the table being sorted
+        die "AI $_ is out of order" unless $_ gt $lastai;
+        $lastai = $_;
+
+        # Group by the first three digits, with a two digit AI sorting first in
+        # the group for its prefix followed by "0"
+        push @keys, substr($_ . '0', 0, 3);
+
+        $ais{$_} = 1;
+        $reqs{$_} = \@req if @req;
+        $exs{$_} = \@ex if @ex;
+
+        my $ai = sprintf('%-6s', "\"$_\"");
+        push @entries, "AI( $ai, $fnc1, $dlpkey,$specstr$title ),";
+        push @binentries, pack('a5 C4 C20 a' . ($max_title+1),
+            $_, $fnc1 =~ /^NO/ ? 0 : 1, $isdlpkey, $minlen, $maxlen, @parts, $rawtitle);
+
     }
 
 }
+
+# Each AI that is referred to by a rule is given a bit within a set of AIs
+my %refs;
+foreach my $ai (keys %reqs, keys %exs) {
+    foreach (@{$exs{$ai} || []}, map { @$_ } @{$reqs{$ai} || []}) {
+        die "AI $ai refers to unknown AI $_" unless $ais{$_};
+        $refs{$_} = 1;
+    }
+}
+my %bits;
+my $bit = 0;
+$bits{$_} = $bit++ foreach sort keys %refs;
+die "Too many AIs are referred to by association rules" if $bit > $max_assoc_bits;
+
+sub aiset {
+    my $set = 0;
+    $set |= 1 << $bits{$_} foreach @_;
+    return sprintf('0x%08x', $set);
+}
+
+my @assocs;
+my @binassocs;
+foreach my $ai (sort keys %ais) {
+    next unless $reqs{$ai} || $exs{$ai} || exists $bits{$ai};
+    my @req = map { aiset(@$_) } @{$reqs{$ai} || []};
+    push @req, aiset() while @req < $max_assoc_reqs;
+    my $rules = join(' ', (map { 'req=' . join(',', @$_) } @{$reqs{$ai} || []}),
+                          ($exs{$ai} ? 'ex=' . join(',', @{$exs{$ai}}) : ()));
+    push @assocs, sprintf('{ %-6s, %s, %s, { %s } },%s',
+        "\"$ai\"", exists $bits{$ai} ? sprintf('%2d', $bits{$ai}) : 'NO_ASSOC_BIT',
+        aiset(@{$exs{$ai} || []}), join(', ', @req), $rules ? "\t// $rules" : '');
+    push @binassocs, pack('a5 C x2 L L' . $max_assoc_reqs,
+        $ai, exists $bits{$ai} ? $bits{$ai} : 0xFF, map { hex } aiset(@{$exs{$ai} || []}), @req);
+}
+
+# Index of the first entry in each group
+my @index;
+my $i = 0;
+for my $key (0..$index_keys) {
+    $i++ while $i < @keys && $keys[$i] < $key;
+    push @index, $i;
+}
+
+if ($binary) {
+    binmode STDOUT;
+    print pack('a4 S S S S S S S' . ($index_keys+1) . ' x2',
+        $dict_magic, $dict_version, $dict_byte_order, $entry_size, scalar @binentries,
+        $assoc_size, scalar @binassocs, @index);
+    print foreach @binentries;
+    print foreach @binassocs;
+    exit 0;
+}
+
+print <<"EOF";
+/*
+ *  Generated from gs1-format-spec.txt by build-gs1-syntax-dict.pl
+ *
+ *  Do not edit this file directly.
+ *
+ */
+
+static const struct aiEntry ai_table[] = {
+EOF
+
+print "\t$_\n" foreach @entries;
+
+print <<"EOF";
+};
+
+static const uint16_t ai_index[AI_INDEX_KEYS+1] = {
+EOF
+
+while (my @line = splice(@index, 0, 10)) {
+    print "\t" . join(', ', map { sprintf('%3d', $_) } @line) . ",\n";
+}
+
+print "};\n";
+
+print <<"EOF";
+
+static const struct aiAssoc ai_assoc[] = {
+EOF
+
+print "\t$_\n" foreach @assocs;
+
+print "};\n";
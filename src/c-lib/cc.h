@@ -49,6 +49,8 @@
 #define MAX_CCA3_SIZE	4	// index to 167 in CC3Sizes
 #define MAX_CCA4_SIZE	4	// index to 197 in CC4Sizes
 
+#define CC_GPA_SIZE	512	// generator polynomial coefficients
+
 
 #include "enc-private.h"
 #include "gs1encoders.h"
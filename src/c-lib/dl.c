@@ -33,47 +33,6 @@
 #include "dl.h"
 
 
-/*
- *  Set of characters that are permissible in URIs, including percent
- *
- */
-static const char *uriCharacters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~:/?#[]@!$&'()*+,;=%";
-
-
-/*
- * List of DL pkeys
- *
- * These are only used for find the beginning of the DL pathinfo.
- *
- */
-static const char* dl_pkeys[] = {
-	"00",		// SSCC
-	"01",		// GTIN; qualifiers 22,10,21 or 235
-	"253",		// GDTI
-	"255",		// GCN
-	"401",		// GINC
-	"402",		// GSIN
-	"414",		// LOC NO.; qualifiers=254 or 7040
-	"417",		// PARTY; qualifiers=7040
-	"8003",		// GRAI
-	"8004",		// GIAI; qualifiers=7040
-	"8006",		// ITIP; qualifiers=22,10,21
-	"8010",		// CPID; qualifiers=8011
-	"8013",		// GMN
-	"8017",		// GSRN - PROVIDER; qualifiers=8019
-	"8018",		// GSRN - RECIPIENT; qualifiers=8019
-};
-
-static bool isDLpkey(char* p) {
-	size_t i;
-	assert(p);
-	for (i = 0; i < SIZEOF_ARRAY(dl_pkeys); i++)
-		if (strcmp(p, dl_pkeys[i]) == 0)
-			return true;
-	return false;
-}
-
-
 static size_t URIunescape(char *out, size_t maxlen, const char *in, const size_t inlen) {
 
 	size_t i, j;
@@ -100,6 +59,15 @@ static size_t URIunescape(char *out, size_t maxlen, const char *in, const size_t
 }
 
 
+// Last "/" within the given range, or NULL
+static char* lastSlash(char *start, char *end) {
+	while (end > start)
+		if (*--end == '/')
+			return end;
+	return NULL;
+}
+
+
 /*
  * Convert DL data to regular AI data string with ^ = FNC1
  *
@@ -114,14 +82,15 @@ static size_t URIunescape(char *out, size_t maxlen, const char *in, const size_t
  */
 bool gs1_parseDLuri(gs1_encoder *ctx, char *dlData, char *dataStr) {
 
-	char *p, *r, *e, *ai, *outai, *outval;
+	char *p, *r, *e, *end, *ai, *outai, *outval;
+	char *dataEnd = dataStr;	// Output cursor
 	char *pi = NULL;	// Path info
 	char *qp = NULL;	// Query params
 	char *fr = NULL;	// Fragment
 	char *dp = NULL;	// DL path info
 	bool ret;
 	size_t i;
-	size_t ailen, vallen;
+	size_t len, ailen, vallen;
 	bool fnc1req = true;
 	const struct aiEntry *entry;
 	char aival[MAX_AI_LEN+1];	// Unescaped AI value
@@ -131,30 +100,32 @@ bool gs1_parseDLuri(gs1_encoder *ctx, char *dlData, char *dataStr) {
 
 	*dataStr = '\0';
 	*ctx->errMsg = '\0';
+	ctx->errCode = gs1_encoder_eNONE;
 	ctx->errFlag = false;
 
 	DEBUG_PRINT("\nParsing DL data: %s\n", dlData);
 
 	p = dlData;
 
-	if (strspn(p, uriCharacters) != strlen(p)) {
-		strcpy(ctx->errMsg, "URI contains illegal characters");
+	len = strlen(p);
+	if (gs1_spanClass((const uint8_t*)p, len, CC_URI) != len) {
+		gs1_setError(ctx, gs1_encoder_eDL_ILLEGAL_CHARACTER, NULL, 0, -1);
 		goto fail;
 	}
 
-	if (strlen(p) >= 8 && strncmp(p, "https://", 8) == 0)
+	if (len >= 8 && strncmp(p, "https://", 8) == 0)
 		p += 8;
-	else if (strlen(p) >= 7 && strncmp(p, "http://", 7) == 0)
+	else if (len >= 7 && strncmp(p, "http://", 7) == 0)
 		p += 7;
 	else {
-		strcpy(ctx->errMsg, "Scheme must be http:// or https://");
+		gs1_setError(ctx, gs1_encoder_eDL_SCHEME, NULL, 0, -1);
 		goto fail;
 	}
 
 	DEBUG_PRINT("  Scheme %.*s\n", (int)(p-dlData-3), dlData);
 
 	if (((r = strchr(p, '/')) == NULL) || r-p < 1) {
-		strcpy(ctx->errMsg, "URI must contain a domain and path info");
+		gs1_setError(ctx, gs1_encoder_eDL_NO_PATH_INFO, NULL, 0, -1);
 		goto fail;
 	}
 
@@ -173,37 +144,32 @@ bool gs1_parseDLuri(gs1_encoder *ctx, char *dlData, char *dataStr) {
 	DEBUG_PRINT("  Path info: %s\n", pi);
 
 	// Search backwards from the end of the path info looking for an
-	// "/AI/value" pair where AI is a DL primary key
-	while ((r = strrchr(pi, '/')) != NULL) {
-
-		*p = '/';				// Restore original pair separator
-							// Clobbers first character of path
-							// info on first iteration
+	// "/AI/value" pair where AI is a DL primary key, each time considering
+	// the path info that precedes the previous pair
+	end = pi + strlen(pi);
+	while ((r = lastSlash(pi, end)) != NULL) {
 
-		// Find start of AI
-		*r = '\0';				// Chop off value
-		p = strrchr(pi, '/'); 			// Beginning of AI
-		*r = '/';				// Restore original AI/value separator
+		p = lastSlash(pi, r);			// Beginning of AI
 		if (!p)					// At beginning of path
 			break;
 
-		DEBUG_PRINT("      %s\n", p);
+		DEBUG_PRINT("      %.*s\n", (int)(end-p), p);
 
 		entry = gs1_lookupAIentry(ctx, p+1, (size_t)(r-p-1));
 		if (!entry)
 			break;
 
-		if (isDLpkey(entry->ai)) {		// Found root of DL path info
+		if (entry->dlPkey) {			// Found root of DL path info
 			dp = p;
 			break;
 		}
 
-		*p = '\0';
+		end = p;
 
 	}
 
 	if (!dp) {
-		strcpy(ctx->errMsg, "No GS1 DL keys found in path info");
+		gs1_setError(ctx, gs1_encoder_eDL_NO_KEYS, NULL, 0, -1);
 		goto fail;
 	}
 
@@ -230,7 +196,7 @@ bool gs1_parseDLuri(gs1_encoder *ctx, char *dlData, char *dataStr) {
 
 ;		// Reverse percent encoding
 		if ((vallen = URIunescape(aival, MAX_AI_LEN, r, (size_t)(p-r))) == 0) {
-			sprintf(ctx->errMsg, "Decoded AI (%.*s) from DL path info too long", (int)ailen, ai);
+			gs1_setError(ctx, gs1_encoder_eDL_PATH_VALUE_TOO_LONG, ai, ailen, -1);
 			goto fail;
 		}
 
@@ -247,11 +213,11 @@ bool gs1_parseDLuri(gs1_encoder *ctx, char *dlData, char *dataStr) {
 
 		if (fnc1req)
 			writeDataStr("^");			// Write FNC1, if required
-		outai = dataStr + strlen(dataStr);		// Save start of AI for AI data
+		outai = dataEnd;				// Save start of AI for AI data
 		nwriteDataStr(ai, ailen);			// Write AI
 		fnc1req = gs1_isFNC1required(entry->ai);	// Record if required before next AI
 
-		outval = dataStr + strlen(dataStr);		// Save start of value for AI data
+		outval = dataEnd;				// Save start of value for AI data
 		nwriteDataStr(aival, vallen);			// Write value
 
 		// Perform certain checks at parse time, before processing the
@@ -268,7 +234,7 @@ bool gs1_parseDLuri(gs1_encoder *ctx, char *dlData, char *dataStr) {
 			ctx->aiData[ctx->numAIs].vallen = (uint8_t)vallen;
 			ctx->numAIs++;
 		} else {
-			strcpy(ctx->errMsg, "Too many AIs");
+			gs1_setError(ctx, gs1_encoder_eTOO_MANY_AIS, NULL, 0, -1);
 			goto fail;
 		}
 	}
@@ -296,7 +262,7 @@ bool gs1_parseDLuri(gs1_encoder *ctx, char *dlData, char *dataStr) {
 		ailen = (size_t)(e-p);
 		entry = NULL;
 		if (gs1_allDigits((uint8_t*)p, ailen) && (entry = gs1_lookupAIentry(ctx, p, ailen)) == NULL) {
-			sprintf(ctx->errMsg, "Unknown AI (%.*s) in query parameters", (int)ailen, p);
+			gs1_setError(ctx, gs1_encoder_eDL_QUERY_UNKNOWN_AI, p, ailen, -1);
 			goto fail;
 		}
 
@@ -310,7 +276,7 @@ bool gs1_parseDLuri(gs1_encoder *ctx, char *dlData, char *dataStr) {
 		// Reverse percent encoding
 		e++;
 		if ((vallen = URIunescape(aival, MAX_AI_LEN, e, (size_t)(r-e))) == 0) {
-			sprintf(ctx->errMsg, "Decoded AI (%s) value from DL query params too long", entry->ai);
+			gs1_setError(ctx, gs1_encoder_eDL_QUERY_VALUE_TOO_LONG, entry->ai, strlen(entry->ai), -1);
 			goto fail;
 		}
 
@@ -327,11 +293,11 @@ bool gs1_parseDLuri(gs1_encoder *ctx, char *dlData, char *dataStr) {
 
 		if (fnc1req)
 			writeDataStr("^");			// Write FNC1, if required
-		outai = dataStr + strlen(dataStr);		// Save start of AI for AI data
+		outai = dataEnd;				// Save start of AI for AI data
 		nwriteDataStr(ai, ailen);			// Write AI
 		fnc1req = gs1_isFNC1required(entry->ai);	// Record if required before next AI
 
-		outval = dataStr + strlen(dataStr);		// Save start of value for AI data
+		outval = dataEnd;				// Save start of value for AI data
 		nwriteDataStr(aival, vallen);			// Write value
 
 		// Perform certain checks at parse time, before processing the
@@ -348,7 +314,7 @@ bool gs1_parseDLuri(gs1_encoder *ctx, char *dlData, char *dataStr) {
 			ctx->aiData[ctx->numAIs].vallen = (uint8_t)vallen;
 			ctx->numAIs++;
 		} else {
-			strcpy(ctx->errMsg, "Too many AIs");
+			gs1_setError(ctx, gs1_encoder_eTOO_MANY_AIS, NULL, 0, -1);
 			goto fail;
 		}
 
@@ -376,11 +342,10 @@ out:
 
 fail:
 
-	if (*ctx->errMsg == '\0')
-		strcpy(ctx->errMsg, "Failed to parse DL data");
-	ctx->errFlag = true;
+	if (ctx->errCode == gs1_encoder_eNONE)
+		gs1_setError(ctx, gs1_encoder_eDL_PARSE_FAILED, NULL, 0, -1);
 
-	DEBUG_PRINT("Parsing DL data failed: %s\n", ctx->errMsg);
+	DEBUG_PRINT("Parsing DL data failed: %s\n", gs1_encoder_getErrMsg(ctx));
 
 	*dataStr = '\0';
 	ret = false;
@@ -408,10 +373,10 @@ static void test_parseDLuri(gs1_encoder *ctx, bool should_succeed, const char *d
 	ctx->numAIs = 0;
 	strcpy(in, dlData);
 	TEST_CHECK(gs1_parseDLuri(ctx, in, out) ^ !should_succeed);
-	TEST_MSG("Err: %s", ctx->errMsg);
+	TEST_MSG("Err: %s", gs1_encoder_getErrMsg(ctx));
 	if (should_succeed)
 		TEST_CHECK(strcmp(out, expect) == 0);
-	TEST_MSG("Given: %s; Got: %s; Expected: %s; Err: %s", dlData, out, expect, ctx->errMsg);
+	TEST_MSG("Given: %s; Got: %s; Expected: %s; Err: %s", dlData, out, expect, gs1_encoder_getErrMsg(ctx));
 
 	TEST_CHECK(strcmp(dlData, in) == 0);
 	TEST_MSG("Input data was erroneously clobbered: %s", in);
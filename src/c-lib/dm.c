@@ -28,6 +28,7 @@
 #include "debug.h"
 #include "dm.h"
 #include "mtx.h"
+#include "rs.h"
 #include "driver.h"
 
 
@@ -94,93 +95,6 @@ static const struct metric metrics[30] = {
 };
 
 
-// Reed Solomon log table in GF(256)
-static const uint8_t rslog[256] = {
-	  0,    // undefined
-	     255,   1, 240,   2, 225, 241,  53,   3,  38, 226, 133, 242,  43,  54, 210,
-	  4, 195,  39, 114, 227, 106, 134,  28, 243, 140,  44,  23,  55, 118, 211, 234,
-	  5, 219, 196,  96,  40, 222, 115, 103, 228,  78, 107, 125, 135,   8,  29, 162,
-	244, 186, 141, 180,  45,  99,  24,  49,  56,  13, 119, 153, 212, 199, 235,  91,
-	  6,  76, 220, 217, 197,  11,  97, 184,  41,  36, 223, 253, 116, 138, 104, 193,
-	229,  86,  79, 171, 108, 165, 126, 145, 136,  34,   9,  74,  30,  32, 163,  84,
-	245, 173, 187, 204, 142,  81, 181, 190,  46,  88, 100, 159,  25, 231,  50, 207,
-	 57, 147,  14,  67, 120, 128, 154, 248, 213, 167, 200,  63, 236, 110,  92, 176,
-	  7, 161,  77, 124, 221, 102, 218,  95, 198,  90,  12, 152,  98,  48, 185, 179,
-	 42, 209,  37, 132, 224,  52, 254, 239, 117, 233, 139,  22, 105,  27, 194, 113,
-	230, 206,  87, 158,  80, 189, 172, 203, 109, 175, 166,  62, 127, 247, 146,  66,
-	137, 192,  35, 252,  10, 183,  75, 216,  31,  83,  33,  73, 164, 144,  85, 170,
-	246,  65, 174,  61, 188, 202, 205, 157, 143, 169,  82,  72, 182, 215, 191, 251,
-	 47, 178,  89, 151, 101,  94, 160, 123,  26, 112, 232,  21,  51, 238, 208, 131,
-	 58,  69, 148,  18,  15,  16,  68,  17, 121, 149, 129,  19, 155,  59, 249,  70,
-	214, 250, 168,  71, 201, 156,  64,  60, 237, 130, 111,  20,  93, 122, 177, 150,
-};
-
-
-// Reed Solomon anti-log table in GF(256)
-static const uint8_t rsalog[256] = {
-	  1,   2,   4,   8,  16,  32,  64, 128,  45,  90, 180,  69, 138,  57, 114, 228,
-	229, 231, 227, 235, 251, 219, 155,  27,  54, 108, 216, 157,  23,  46,  92, 184,
-	 93, 186,  89, 178,  73, 146,   9,  18,  36,  72, 144,  13,  26,  52, 104, 208,
-	141,  55, 110, 220, 149,   7,  14,  28,  56, 112, 224, 237, 247, 195, 171, 123,
-	246, 193, 175, 115, 230, 225, 239, 243, 203, 187,  91, 182,  65, 130,  41,  82,
-	164, 101, 202, 185,  95, 190,  81, 162, 105, 210, 137,  63, 126, 252, 213, 135,
-	 35,  70, 140,  53, 106, 212, 133,  39,  78, 156,  21,  42,  84, 168, 125, 250,
-	217, 159,  19,  38,  76, 152,  29,  58, 116, 232, 253, 215, 131,  43,  86, 172,
-	117, 234, 249, 223, 147,  11,  22,  44,  88, 176,  77, 154,  25,  50, 100, 200,
-	189,  87, 174, 113, 226, 233, 255, 211, 139,  59, 118, 236, 245, 199, 163, 107,
-	214, 129,  47,  94, 188,  85, 170, 121, 242, 201, 191,  83, 166,  97, 194, 169,
-	127, 254, 209, 143,  51, 102, 204, 181,  71, 142,  49,  98, 196, 165, 103, 206,
-	177,  79, 158,  17,  34,  68, 136,  61, 122, 244, 197, 167,  99, 198, 161, 111,
-	222, 145,  15,  30,  60, 120, 240, 205, 183,  67, 134,  33,  66, 132,  37,  74,
-	148,   5,  10,  20,  40,  80, 160, 109, 218, 153,  31,  62, 124, 248, 221, 151,
-	  3,   6,  12,  24,  48,  96, 192, 173, 119, 238, 241, 207, 179,  75, 150,   1,
-};
-
-
-// Reed Solomon product in GF(256)
-static inline uint8_t rsProd(const uint8_t a, const uint8_t b) {
-	return a && b ? rsalog[ (rslog[a] + rslog[b]) % 255 ] : 0;
-}
-
-
-// Generate Reed Solomon coefficients using a generator 2
-static void rsGenerateCoeffs(const int size, uint8_t *coeffs) {
-
-	int i, j;
-
-	assert(size >= 1);  // Satisfy static analysis
-
-	coeffs[0] = 1;
-	for (i = 1; i <= size; i++) {
-		coeffs[i] = coeffs[i-1];
-		for (j = i-1; j > 0; j--)
-			coeffs[j] = coeffs[j-1] ^ rsProd(coeffs[j], rsalog[i]);
-		coeffs[0] = rsProd(coeffs[0], rsalog[i]);
-	}
-
-}
-
-
-// Perform Reed Solomon ECC codeword calculation
-static void rsEncode(const uint8_t* datcws, const int datlen, uint8_t* ecccws, const int ecclen, const uint8_t* coeffs) {
-
-	int i, j;
-	uint8_t tmp[MAX_DM_DAT_CWS_PER_BLK + MAX_DM_ECC_CWS_PER_BLK] = { 0 };
-
-	assert(datlen <= MAX_DM_DAT_CWS_PER_BLK);
-	assert(ecclen <= MAX_DM_ECC_CWS_PER_BLK);
-
-	memcpy(tmp, datcws, (size_t)datlen);
-
-	for (i = 0; i < datlen; i++)
-		for (j = 0; j < ecclen; j++)
-			tmp[i+j+1] = rsProd(coeffs[ecclen-j-1], tmp[i]) ^ tmp[i+j+1];
-
-	memcpy(ecccws, tmp + datlen, (size_t)ecclen);
-
-}
-
-
 // Generate the codeword sequence that represents the data message
 static void createCodewords(gs1_encoder *ctx, const uint8_t *string, uint8_t cws[MAX_DM_CWS], uint16_t* cwslen) {
 
@@ -256,12 +170,11 @@ static const struct metric* selectVersion(gs1_encoder *ctx, const uint16_t cwsle
 static void finaliseCodewords(gs1_encoder *ctx, uint8_t *cws, uint16_t *cwslen, const struct metric *m) {
 
 	uint8_t tmpcws[MAX_DM_DAT_CWS_PER_BLK+MAX_DM_ECC_CWS_PER_BLK] = { 0 };
-	uint8_t coeffs[MAX_DM_ECC_CWS_PER_BLK+1];
+	struct gs1_rsCode *rs = ctx->rs_code;
 	int i, j, pad, offset;
 	uint8_t *p;
 
-	(void)ctx;
-
+	assert(rs);
 	assert(*cwslen <= m->ncws);
 
 	// Complete the message by adding pseudo-random padding codewords
@@ -276,8 +189,10 @@ static void finaliseCodewords(gs1_encoder *ctx, uint8_t *cws, uint16_t *cwslen,
 
 	DEBUG_PRINT_CWS("Padded", cws, (uint16_t)(p-cws));
 
-	// Generate coefficients
-	rsGenerateCoeffs(m->rscw / m->rsbl, coeffs);
+	// Prepare the generator once for every block, unless retained from an
+	// earlier symbol
+	assert(m->rscw / m->rsbl <= MAX_DM_ECC_CWS_PER_BLK);
+	gs1_rsPrepareCode(rs, gs1_rsFieldDM, m->rscw / m->rsbl);
 
 	// Error correction for interleaved blocks of codewords
 	for (i = 0; i < m->rsbl; i++) {
@@ -286,7 +201,8 @@ static void finaliseCodewords(gs1_encoder *ctx, uint8_t *cws, uint16_t *cwslen,
 		for (j = i; j < m->ncws; j += m->rsbl)
 			*p++ = cws[j];
 
-		rsEncode(tmpcws, (int)(p-tmpcws), p, m->rscw/m->rsbl, coeffs);
+		assert(p-tmpcws <= MAX_DM_DAT_CWS_PER_BLK);
+		gs1_rsEncode(rs, tmpcws, (int)(p-tmpcws), p);
 
 		offset = m->rscw == 620 ? (i<8 ? 2:-8) : 0;
 		for (j = i; j < m->rscw; j += m->rsbl)
@@ -465,9 +381,8 @@ static void createMatrix(gs1_encoder *ctx, uint8_t *mtx, const uint8_t *cws, con
 }
 
 
-static int DMenc(gs1_encoder *ctx, const uint8_t string[], struct patternLength *pats) {
+static int DMenc(gs1_encoder *ctx, const uint8_t string[], uint8_t mtx[], int *cols) {
 
-	uint8_t mtx[MAX_DM_BYTES] = { 0 };
 	uint8_t cws[MAX_DM_CWS] = { 0 };
 	uint16_t cwslen = 0;
 	const struct metric *m;
@@ -523,10 +438,7 @@ static int DMenc(gs1_encoder *ctx, const uint8_t string[], struct patternLength
 
 	DEBUG_PRINT_MATRIX("Matrix", mtx, m->cols + 2*DM_QZ, m->rows + 2*DM_QZ);
 
-	gs1_mtxToPatterns(mtx, m->cols + 2*DM_QZ, m->rows + 2*DM_QZ, pats);
-
-	DEBUG_PRINT_PATTERN_LENGTHS("Patterns", pats, m->rows);
-
+	*cols = m->cols + 2*DM_QZ;
 	return m->rows + 2*DM_QZ;
 
 }
@@ -536,17 +448,23 @@ void gs1_DM(gs1_encoder *ctx) {
 
 	struct sPrints prints = { 0 };
 	struct patternLength *pats;
+	uint8_t mtx[MAX_DM_BYTES] = { 0 };
 	char* dataStr = ctx->dataStr;
 	int rows, cols, i;
 
-	pats = ctx->dm_pats;
+	if (!(rows = DMenc(ctx, (uint8_t*)dataStr, mtx, &cols)) || ctx->errFlag)
+		goto out;
 
-	if (!(rows = DMenc(ctx, (uint8_t*)dataStr, pats)) || ctx->errFlag)
+	if (ctx->moduleMode) {
+		gs1_driverMatrix(ctx, mtx, cols, rows);
 		goto out;
+	}
+
+	pats = ctx->dm_pats;
+
+	gs1_mtxToPatterns(mtx, cols, rows, pats);
 
-	cols = 0;
-	for (i = 0; i < pats[0].length; i++)
-		cols += pats[0].pattern[i];
+	DEBUG_PRINT_PATTERN_LENGTHS("Patterns", pats, rows);
 
 	gs1_driverInit(ctx, (long)ctx->pixMult*cols, (long)ctx->pixMult*rows);
 
@@ -21,6 +21,7 @@
 #include <assert.h>
 #include <float.h>
 #include <math.h>
+#include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdint.h>
@@ -31,27 +32,55 @@
 #include "driver.h"
 
 
-static bool emitData(gs1_encoder *ctx, const void *data, const size_t len) {
+static bool toBuffer(gs1_encoder *ctx) {
+	return strcmp(ctx->outFile, "") == 0 || ctx->moduleMode;
+}
+
+
+// Ensure that the output buffer has room for a further len bytes
+static bool growBuffer(gs1_encoder *ctx, const size_t len) {
 
 	uint8_t *buf;
+	size_t cap;
+
+	if (ctx->bufferSize + len <= ctx->bufferCap)
+		return true;
+
+	if (ctx->userBuffer) {
+		strcpy(ctx->errMsg, "Output buffer is too small");
+		ctx->errFlag = true;
+		return false;
+	}
+
+	for (cap = ctx->bufferCap ? ctx->bufferCap * 2 : 1024; ctx->bufferSize + len > cap; cap *= 2);
+	if ((buf = realloc(ctx->buffer, cap)) == NULL) {
+		free(ctx->buffer);
+		ctx->buffer = NULL;
+		ctx->bufferCap = 0;
+		ctx->bufferSize = 0;
+		ctx->bufferWidth = 0;
+		ctx->bufferHeight = 0;
+		strcpy(ctx->errMsg, "Failed to expand output buffer");
+		ctx->errFlag = true;
+		return false;
+	};
+	ctx->buffer = buf;
+	ctx->bufferCap = cap;
+
+	return true;
 
-	if (strcmp(ctx->outFile, "") != 0) {
+}
+
+
+static bool emitData(gs1_encoder *ctx, const void *data, const size_t len) {
+
+	if (ctx->measureOnly) {
+		ctx->driver_outSize += len;
+	} else if (!toBuffer(ctx)) {
 		fwrite(data, len, 1, ctx->outfp);
 	} else {
-		if (ctx->bufferSize + len > ctx-> bufferCap) {
-			if ((buf = realloc(ctx->buffer, ctx->bufferCap * 2)) == NULL) {
-				free(ctx->buffer);
-				ctx->bufferCap = 0;
-				ctx->bufferSize = 0;
-				ctx->bufferWidth = 0;
-				ctx->bufferHeight = 0;
-				strcpy(ctx->errMsg, "Failed to expand output buffer");
-				ctx->errFlag = true;
-				return false;
-			};
-			ctx->buffer = buf;
-			ctx->bufferCap *= 2;
-		}
+		if (!growBuffer(ctx, len))
+			return false;
 		memcpy(&ctx->buffer[ctx->bufferSize], data, len);
 		ctx->bufferSize += len;
 	}
@@ -60,6 +89,9 @@ static bool emitData(gs1_encoder *ctx, const void *data, const size_t len) {
 }
 
 
+#define BMP_HDR_LEN 0x3E
+
+
 static void bmpHeader(gs1_encoder *ctx, const long xdim, const long ydim) {
 
 	uint8_t id[2] = {'B','M'};
@@ -87,7 +119,7 @@ static void bmpHeader(gs1_encoder *ctx, const long xdim, const long ydim) {
 
 	header.width = (uint32_t)xdim;
 	header.height = (uint32_t)ydim;
-	header.fileLength = (uint32_t)(0x3E + (((xdim+31)/32)*4) * ydim); // pad rows to 32-bit boundary
+	header.fileLength = (uint32_t)(BMP_HDR_LEN + (((xdim+31)/32)*4) * ydim); // pad rows to 32-bit boundary
 
 	emitData(ctx, &id, sizeof(id));
 	emitData(ctx, &header, sizeof(header));
@@ -160,43 +192,85 @@ static void tifHeader(gs1_encoder *ctx, const long xdim, const long ydim) {
 	return;
 }
 
+#define TIF_HDR_LEN (8+2+TAG_CNT*12+4+8+8)
 
-static void printElm(gs1_encoder *ctx, const int width, const int color, int *bits, int *ndx, const uint8_t xorMsk) {
 
-	int i;
+struct lineState {
+	int bits;
+	int ndx;
+	uint8_t xorMsk;
+};
+
+
+static void putBit(gs1_encoder *ctx, struct lineState *s, const int color) {
+
 	uint8_t *line = ctx->driver_line;
 	uint8_t *lineUCut = ctx->driver_lineUCut;
 
-	for (i = 0; i < width; i++) {
-		*bits = (*bits<<1) + color;
-		if (*bits > 0xff) {
-			lineUCut[*ndx] = (uint8_t)(((line[*ndx]^xorMsk)&(*bits&0xff))^xorMsk); // Y undercut
-			line[(*ndx)++] = (uint8_t)((*bits&0xff) ^ xorMsk);
-			if (*ndx >= MAX_LINE/8 + 1) {
-				*ndx = 0;
-				strcpy(ctx->errMsg, "Print line too long in graphic line.");
-				ctx->errFlag = true;
-				return;
-			}
-			*bits = 1;
+	s->bits = (s->bits<<1) + color;
+	if (s->bits > 0xff) {
+		lineUCut[s->ndx] = (uint8_t)(((line[s->ndx]^s->xorMsk)&(s->bits&0xff))^s->xorMsk); // Y undercut
+		line[s->ndx++] = (uint8_t)((s->bits&0xff) ^ s->xorMsk);
+		if ((size_t)s->ndx >= ctx->driver_lineCap) {
+			s->ndx = 0;
+			strcpy(ctx->errMsg, "Print line too long in graphic line.");
+			ctx->errFlag = true;
+			return;
 		}
+		s->bits = 1;
 	}
 	return;
 }
 
 
+// Fill a span of pixels, setting whole bytes at once
+static void printElm(gs1_encoder *ctx, int width, const int color, void *arg) {
+
+	struct lineState *s = arg;
+	uint8_t *line = ctx->driver_line;
+	uint8_t *lineUCut = ctx->driver_lineUCut;
+	uint8_t fill;
+	int n;
+
+	// Complete any partial byte
+	for (; width > 0 && s->bits != 1; width--)
+		putBit(ctx, s, color);
+
+	n = width / 8;
+	if (n > 0) {
+		if ((size_t)(s->ndx + n) >= ctx->driver_lineCap) {
+			s->ndx = 0;
+			strcpy(ctx->errMsg, "Print line too long in graphic line.");
+			ctx->errFlag = true;
+			return;
+		}
+		// Y undercut keeps only what was dark in the line above
+		fill = (uint8_t)((color ? 0xFF : 0x00) ^ s->xorMsk);
+		if (color)
+			memcpy(&lineUCut[s->ndx], &line[s->ndx], (size_t)n);
+		else
+			memset(&lineUCut[s->ndx], fill, (size_t)n);
+		memset(&line[s->ndx], fill, (size_t)n);
+		s->ndx += n;
+		width -= n * 8;
+	}
+
+	for (; width > 0; width--)
+		putBit(ctx, s, color);
+
+	return;
+}
+
+
 #define WHITE 0
 
-static void printElmnts(gs1_encoder *ctx, const struct sPrints *prints) {
+// Walk the elements of a row from left to right, with the undercut applied
+static void walkElmnts(gs1_encoder *ctx, const struct sPrints *prints,
+		       void (*elm)(gs1_encoder *ctx, int width, int color, void *arg), void *arg) {
 
-	int i, bits, width, ndx, white;
-	uint8_t xorMsk;
+	int i, width, white;
 	int undercut;
-	uint8_t *line = ctx->driver_line;
-	uint8_t *lineUCut = ctx->driver_lineUCut;
 
-	bits = 1;
-	ndx = 0;
 	if (prints->whtFirst) {
 		white = WHITE;
 		undercut = ctx->Xundercut;
@@ -209,20 +283,13 @@ static void printElmnts(gs1_encoder *ctx, const struct sPrints *prints) {
 		white = white^1; // invert if reversed even elements
 		undercut = -undercut;
 	}
-	xorMsk = ctx->format == gs1_encoder_dBMP ? 0xFF : 0; // invert BMP bits
-	if (ctx->line1) {
-		for (i = 0; i < MAX_LINE/8; i++) {
-			line[i] = xorMsk;
-		}
-		ctx->line1 = false;
-	}
 	// fill left pad worth of WHITE
-	printElm(ctx, prints->leftPad*ctx->pixMult, WHITE , &bits, &ndx, xorMsk);
+	elm(ctx, prints->leftPad*ctx->pixMult, WHITE, arg);
 
 	// process WHITE/BLACK elements in pairs for undercut
 	if (prints->guards) { // print guard pattern
-		printElm(ctx, ctx->pixMult + undercut, white , &bits, &ndx, xorMsk);
-		printElm(ctx, ctx->pixMult - undercut, (white^1) , &bits, &ndx, xorMsk);
+		elm(ctx, ctx->pixMult + undercut, white, arg);
+		elm(ctx, ctx->pixMult - undercut, (white^1), arg);
 	}
 	for(i = 0; i < prints->elmCnt-1; i += 2) {
 		if (prints->reverse) {
@@ -231,7 +298,7 @@ static void printElmnts(gs1_encoder *ctx, const struct sPrints *prints) {
 		else {
 			width = (int)prints->pattern[i]*ctx->pixMult + undercut;
 		}
-		printElm(ctx, width, white , &bits, &ndx, xorMsk);
+		elm(ctx, width, white, arg);
 
 		if (prints->reverse) {
 			width = (int)prints->pattern[prints->elmCnt-2-i]*ctx->pixMult - undercut;
@@ -239,7 +306,7 @@ static void printElmnts(gs1_encoder *ctx, const struct sPrints *prints) {
 		else {
 			width = (int)prints->pattern[i+1]*ctx->pixMult - undercut;
 		}
-		printElm(ctx, width, (white^1) , &bits, &ndx, xorMsk);
+		elm(ctx, width, (white^1), arg);
 	}
 
 	// process any trailing odd numbered element with no undercut
@@ -251,10 +318,10 @@ static void printElmnts(gs1_encoder *ctx, const struct sPrints *prints) {
 			else {
 				width = (int)prints->pattern[i]*ctx->pixMult + undercut;
 			}
-			printElm(ctx, width, white , &bits, &ndx, xorMsk);
+			elm(ctx, width, white, arg);
 
-			printElm(ctx, ctx->pixMult - undercut, (white^1) , &bits, &ndx, xorMsk);
-			printElm(ctx, ctx->pixMult, white , &bits, &ndx, xorMsk); // last- no undercut
+			elm(ctx, ctx->pixMult - undercut, (white^1), arg);
+			elm(ctx, ctx->pixMult, white, arg); // last- no undercut
 		}
 		else { // no guard, print last odd without undercut
 			if (prints->reverse) {
@@ -263,52 +330,552 @@ static void printElmnts(gs1_encoder *ctx, const struct sPrints *prints) {
 			else {
 				width = (int)prints->pattern[i]*ctx->pixMult;
 			}
-			printElm(ctx, width, white , &bits, &ndx, xorMsk);
+			elm(ctx, width, white, arg);
 		}
 	}
 	else if (prints->guards) { // even number, just print guard pattern
-		printElm(ctx, ctx->pixMult + undercut, white , &bits, &ndx, xorMsk);
-		printElm(ctx, ctx->pixMult - undercut, (white^1) , &bits, &ndx, xorMsk);
+		elm(ctx, ctx->pixMult + undercut, white, arg);
+		elm(ctx, ctx->pixMult - undercut, (white^1), arg);
 	}
 	// fill right pad worth of WHITE
-	printElm(ctx, prints->rightPad*ctx->pixMult, WHITE , &bits, &ndx, xorMsk);
+	elm(ctx, prints->rightPad*ctx->pixMult, WHITE, arg);
+
+}
+
+
+// Render a row into the print lines, returning its length in bytes or -1 on error
+static int renderRow(gs1_encoder *ctx, const struct sPrints *prints) {
+
+	int i;
+	struct lineState s;
+	uint8_t *line = ctx->driver_line;
+	uint8_t *lineUCut = ctx->driver_lineUCut;
+
+	s.bits = 1;
+	s.ndx = 0;
+	s.xorMsk = ctx->format == gs1_encoder_dBMP ? 0xFF : 0; // invert BMP bits
+	if (ctx->line1) {
+		for (i = 0; i < (int)ctx->driver_lineCap - 1; i++) {
+			line[i] = s.xorMsk;
+		}
+		ctx->line1 = false;
+	}
+
+	walkElmnts(ctx, prints, printElm, &s);
+
 	// pad last byte's bits
-	if (bits != 1) {
-		while ((bits = (bits<<1) + WHITE) <= 0xff);
-		lineUCut[ndx] = (uint8_t)(((line[ndx]^xorMsk)&(bits&0xff))^xorMsk); // Y undercut
-		line[ndx++] = (uint8_t)((bits&0xff) ^ xorMsk);
-		if (ndx > MAX_LINE/8 + 1) {
+	if (s.bits != 1) {
+		while ((s.bits = (s.bits<<1) + WHITE) <= 0xff);
+		lineUCut[s.ndx] = (uint8_t)(((line[s.ndx]^s.xorMsk)&(s.bits&0xff))^s.xorMsk); // Y undercut
+		line[s.ndx++] = (uint8_t)((s.bits&0xff) ^ s.xorMsk);
+		if ((size_t)s.ndx > ctx->driver_lineCap) {
 			strcpy(ctx->errMsg, "Print line too long");
 			ctx->errFlag = true;
-			return;
+			return -1;
 		}
 	}
 	if (ctx->format == gs1_encoder_dBMP) {
-		while ((ndx & 3) != 0) {
-			line[ndx++] = 0xFF; // pad to long word boundary for .BMP
-			if (ndx >= MAX_LINE/8 + 1) {
+		while ((s.ndx & 3) != 0) {
+			lineUCut[s.ndx] = 0xFF;
+			line[s.ndx++] = 0xFF; // pad to long word boundary for .BMP
+			if ((size_t)s.ndx >= ctx->driver_lineCap) {
 				strcpy(ctx->errMsg, "Print line too long");
 				ctx->errFlag = true;
-				return;
+				return -1;
+			}
+		}
+	}
+
+	return ctx->errFlag ? -1 : s.ndx;
+}
+
+
+/*
+ *  ZPL graphic field data is ASCII hex with run-length compression. A
+ *  repeated hex digit is preceded by a count, where G-Y represent 1-19 and
+ *  g-z represent 20-400 in steps of 20. A trailing run of 0 or F digits is
+ *  replaced by "," or "!", and a line that is the same as the previous line
+ *  is replaced by ":".
+ *
+ */
+static void zplRow(gs1_encoder *ctx, const uint8_t *row, const size_t len, const bool repeat) {
+
+	static const char hex[] = "0123456789ABCDEF";
+	char out[64];
+	size_t i, run, n = len * 2, o = 0;
+	int c;
+
+#define NIBBLE(i) ((row[(i)/2] >> ((i) & 1 ? 0 : 4)) & 0x0F)
+
+	if (repeat) {
+		emitData(ctx, ":", 1);
+		return;
+	}
+
+	for (i = 0; i < n; i += run) {
+		c = NIBBLE(i);
+		for (run = 1; i + run < n && NIBBLE(i + run) == c; run++);
+		if (i + run == n && (c == 0x0 || c == 0xF)) {
+			out[o++] = c == 0x0 ? ',' : '!';
+			break;
+		}
+		while (run > 400) {
+			out[o++] = 'z';
+			out[o++] = hex[c];
+			run -= 400;
+			i += 400;
+			if (o > sizeof(out) - 4) {
+				emitData(ctx, out, o);
+				o = 0;
 			}
 		}
+		if (run >= 20)
+			out[o++] = (char)('f' + run / 20);
+		if (run > 1 && run % 20 != 0)
+			out[o++] = (char)('F' + run % 20);
+		out[o++] = hex[c];
+		if (o > sizeof(out) - 4) {
+			emitData(ctx, out, o);
+			o = 0;
+		}
+	}
+
+#undef NIBBLE
+
+	emitData(ctx, out, o);
+
+}
+
+
+// ESC/POS raster bit image, sent in bands of lines that each have a "GS v 0" header
+static void escposRow(gs1_encoder *ctx, const uint8_t *row, const size_t len) {
+
+	uint8_t cmd[8] = { 0x1D, 'v', '0', 0 };
+	int lines;
+
+	if (ctx->driver_y % ESCPOS_BAND_LINES == 0) {
+		lines = ctx->driver_ydim - ctx->driver_y;
+		if (lines > ESCPOS_BAND_LINES)
+			lines = ESCPOS_BAND_LINES;
+		cmd[4] = (uint8_t)(len & 0xFF);
+		cmd[5] = (uint8_t)(len >> 8);
+		cmd[6] = (uint8_t)(lines & 0xFF);
+		cmd[7] = (uint8_t)(lines >> 8);
+		emitData(ctx, cmd, sizeof(cmd));
+	}
+	emitData(ctx, row, len);
+
+}
+
+
+// BMP lines are stored bottom-up, so each is copied directly into its place
+// within the image. A file is written in order once the image is complete,
+// since the output may not be seekable.
+static void bmpRow(gs1_encoder *ctx, const uint8_t *row, const size_t len) {
+
+	size_t offset = BMP_HDR_LEN + (size_t)(ctx->driver_ydim - 1 - ctx->driver_y) * len;
+
+	if (ctx->errFlag)
+		return;
+
+	assert(ctx->driver_y < ctx->driver_ydim);
+
+	if (!toBuffer(ctx)) {
+		assert(ctx->driver_bmpImage);
+		memcpy(&ctx->driver_bmpImage[offset - BMP_HDR_LEN], row, len);
+	} else {
+		assert(offset + len <= ctx->bufferSize);
+		memcpy(&ctx->buffer[offset], row, len);
 	}
 
-	for (i = 0; i < ctx->Yundercut; i++) {
-		emitData(ctx, lineUCut, (size_t)ndx * sizeof(uint8_t));
+}
+
+
+// Output a raster line, which repeats the previous line if so indicated
+static void emitRow(gs1_encoder *ctx, const uint8_t *row, const size_t len, const bool repeat) {
+	if (ctx->streamRows)
+		ctx->rowCallback(ctx->rowCallbackData, row, len);
+	else if (ctx->format == gs1_encoder_dBMP)
+		bmpRow(ctx, row, len);
+	else if (ctx->format == gs1_encoder_dZPL)
+		zplRow(ctx, row, len, repeat);
+	else if (ctx->format == gs1_encoder_dESCPOS)
+		escposRow(ctx, row, len);
+	else
+		emitData(ctx, row, len);
+	ctx->driver_y++;
+}
+
+
+// Output a raster line a number of times
+static void emitRows(gs1_encoder *ctx, const uint8_t *row, const size_t len, const int count) {
+
+	static const char repeats[] = "::::::::::::::::::::::::::::::::";
+	size_t done, size;
+	int i;
+
+	if (count <= 0 || ctx->errFlag)
+		return;
+
+	if (!ctx->streamRows && !ctx->measureOnly && toBuffer(ctx) &&
+	    (ctx->format == gs1_encoder_dRAW || ctx->format == gs1_encoder_dTIF)) {
+		// Copy the line once, then double up the copies already made
+		size = len * (size_t)count;
+		if (!growBuffer(ctx, size))
+			return;
+		memcpy(&ctx->buffer[ctx->bufferSize], row, len);
+		for (done = len; done < size; done *= 2)
+			memcpy(&ctx->buffer[ctx->bufferSize + done], &ctx->buffer[ctx->bufferSize],
+			       done < size - done ? done : size - done);
+		ctx->bufferSize += size;
+		ctx->driver_y += count;
+		return;
 	}
-	for ( ; i < prints->height; i++) {
-		emitData(ctx, line, (size_t)ndx * sizeof(uint8_t));
+
+	if (!ctx->streamRows && ctx->format == gs1_encoder_dZPL) {
+		zplRow(ctx, row, len, false);
+		for (i = count - 1; i > 0; i -= (int)sizeof(repeats) - 1)
+			emitData(ctx, repeats, i < (int)sizeof(repeats) - 1 ? (size_t)i : sizeof(repeats) - 1);
+		ctx->driver_y += count;
+		return;
 	}
+
+	for (i = 0; i < count; i++)
+		emitRow(ctx, row, len, i > 0);
+
+}
+
+
+static void printElmnts(gs1_encoder *ctx, const struct sPrints *prints) {
+
+	int ndx;
+
+	if ((ndx = renderRow(ctx, prints)) < 0)
+		return;
+
+	emitRows(ctx, ctx->driver_lineUCut, (size_t)ndx * sizeof(uint8_t), ctx->Yundercut);
+	emitRows(ctx, ctx->driver_line, (size_t)ndx * sizeof(uint8_t), prints->height - ctx->Yundercut);
+
 	return;
 }
 
 
+/*
+ *  Vector formats are generated from the runs of dark pixels in each row,
+ *  rather than from raster lines. A run that continues unchanged into the
+ *  following lines extends the rectangle that it started, so each rectangle
+ *  is emitted only once it ends.
+ *
+ */
+static bool isVector(const int format) {
+	return format == gs1_encoder_dSVG || format == gs1_encoder_dEPS || format == gs1_encoder_dPDF;
+}
+
+
+static void emitf(gs1_encoder *ctx, const char *fmt, ...) {
+
+	char str[256];
+	va_list ap;
+	int len;
+
+	if (ctx->errFlag)
+		return;
+
+	va_start(ap, fmt);
+	len = vsnprintf(str, sizeof(str), fmt, ap);
+	va_end(ap);
+	assert(len >= 0 && (size_t)len < sizeof(str));
+
+	if (emitData(ctx, str, (size_t)len))
+		ctx->driver_vecBytes += (size_t)len;
+
+}
+
+
+static void vectorHeader(gs1_encoder *ctx, const long xdim, const long ydim) {
+
+	ctx->driver_vecBytes = 0;
+
+	switch (ctx->format) {
+	case gs1_encoder_dSVG:
+		emitf(ctx, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+		emitf(ctx, "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" width=\"%ld\" height=\"%ld\" viewBox=\"0 0 %ld %ld\" shape-rendering=\"crispEdges\">\n",
+			xdim, ydim, xdim, ydim);
+		emitf(ctx, "<rect width=\"%ld\" height=\"%ld\" fill=\"#FFFFFF\"/>\n", xdim, ydim);
+		emitf(ctx, "<path fill=\"#000000\" d=\"\n");
+		break;
+	case gs1_encoder_dEPS:
+		emitf(ctx, "%%!PS-Adobe-3.0 EPSF-3.0\n");
+		emitf(ctx, "%%%%Creator: GS1 Barcode Engine\n");
+		emitf(ctx, "%%%%BoundingBox: 0 0 %ld %ld\n", xdim, ydim);
+		emitf(ctx, "%%%%EndComments\n");
+		emitf(ctx, "/R { rectfill } bind def\n");
+		emitf(ctx, "1 setgray 0 0 %ld %ld R\n0 setgray\n", xdim, ydim);
+		break;
+	case gs1_encoder_dPDF:
+		emitf(ctx, "%%PDF-1.4\n");
+		ctx->driver_pdfObj[0] = ctx->driver_vecBytes;
+		emitf(ctx, "1 0 obj\n<< /Type /Catalog /Pages 2 0 R >>\nendobj\n");
+		ctx->driver_pdfObj[1] = ctx->driver_vecBytes;
+		emitf(ctx, "2 0 obj\n<< /Type /Pages /Kids [3 0 R] /Count 1 >>\nendobj\n");
+		ctx->driver_pdfObj[2] = ctx->driver_vecBytes;
+		emitf(ctx, "3 0 obj\n<< /Type /Page /Parent 2 0 R /MediaBox [0 0 %ld %ld] /Contents 4 0 R /Resources << >> >>\nendobj\n",
+			xdim, ydim);
+		ctx->driver_pdfObj[3] = ctx->driver_vecBytes;
+		emitf(ctx, "4 0 obj\n<< /Length 5 0 R >>\nstream\n");
+		ctx->driver_pdfStream = ctx->driver_vecBytes;
+		emitf(ctx, "1 g\n0 0 %ld %ld re f\n0 g\n", xdim, ydim);
+		break;
+	default:
+		assert(false);
+	}
+
+}
+
+
+// Emit a rectangle that ends above line y2. EPS and PDF coordinates start at the bottom
+static void vectorRect(gs1_encoder *ctx, const struct driverSpan *rect, const int y2) {
+
+	int h = y2 - rect->y;
+
+	if (h <= 0)
+		return;
+
+	switch (ctx->format) {
+	case gs1_encoder_dSVG:
+		emitf(ctx, "M%d %dh%dv%dh-%dz\n", rect->x, rect->y, rect->w, h, rect->w);
+		break;
+	case gs1_encoder_dEPS:
+		emitf(ctx, "%d %d %d %d R\n", rect->x, ctx->driver_ydim - y2, rect->w, h);
+		break;
+	case gs1_encoder_dPDF:
+		emitf(ctx, "%d %d %d %d re f\n", rect->x, ctx->driver_ydim - y2, rect->w, h);
+		break;
+	}
+
+}
+
+
+struct spanState {
+	struct driverSpan *spans;
+	int num;
+	int x;
+};
+
+
+static void spanElm(gs1_encoder *ctx, const int width, const int color, void *arg) {
+
+	struct spanState *s = arg;
+
+	if (width <= 0)
+		return;
+
+	if (color != WHITE) {
+		if (s->num > 0 && s->spans[s->num-1].x + s->spans[s->num-1].w == s->x) {
+			s->spans[s->num-1].w += width;	// Adjoining dark elements form a single run
+		} else if ((size_t)s->num < ctx->driver_spanCap) {
+			s->spans[s->num].x = s->x;
+			s->spans[s->num].w = width;
+			s->num++;
+		} else {
+			strcpy(ctx->errMsg, "Print line too long in graphic line.");
+			ctx->errFlag = true;
+		}
+	}
+	s->x += width;
+
+}
+
+
+// Runs that are dark in both rows, as for the Y undercut of raster lines
+static int intersectSpans(const struct driverSpan *a, const int numA,
+			  const struct driverSpan *b, const int numB, struct driverSpan *out) {
+
+	int i = 0, j = 0, n = 0, lo, hi;
+
+	while (i < numA && j < numB) {
+		lo = a[i].x > b[j].x ? a[i].x : b[j].x;
+		hi = a[i].x + a[i].w < b[j].x + b[j].w ? a[i].x + a[i].w : b[j].x + b[j].w;
+		if (lo < hi) {
+			out[n].x = lo;
+			out[n].w = hi - lo;
+			n++;
+		}
+		if (a[i].x + a[i].w < b[j].x + b[j].w)
+			i++;
+		else
+			j++;
+	}
+
+	return n;
+
+}
+
+
+/*
+ *  Extend the open rectangles by a band of identical lines having the given
+ *  runs. Rectangles that do not continue are emitted and the runs become the
+ *  open rectangles, inheriting the starting line of any that they continue.
+ *
+ */
+static void vectorBand(gs1_encoder *ctx, struct driverSpan *spans, const int num, const int lines) {
+
+	struct driverSpan *rects = ctx->driver_rects;
+	int i = 0, j = 0;
+
+	while (i < ctx->driver_numRects || j < num) {
+		if (j == num || (i < ctx->driver_numRects && rects[i].x < spans[j].x)) {
+			vectorRect(ctx, &rects[i++], ctx->driver_y);
+		} else if (i == ctx->driver_numRects || rects[i].x > spans[j].x) {
+			spans[j++].y = ctx->driver_y;
+		} else if (rects[i].w == spans[j].w) {
+			spans[j++].y = rects[i++].y;
+		} else {
+			vectorRect(ctx, &rects[i++], ctx->driver_y);
+		}
+	}
+
+	ctx->driver_rects = spans;
+	ctx->driver_numRects = num;
+	ctx->driver_y += lines;
+
+}
+
+
+static void vectorRow(gs1_encoder *ctx, const struct sPrints *prints) {
+
+	struct driverSpan *spare[2];
+	struct spanState s;
+	int i, n, lines;
+
+	// The span sets that are not holding the open rectangles
+	for (i = 0, n = 0; i < 3; i++) {
+		if (&ctx->driver_spans[(size_t)i * ctx->driver_spanCap] != ctx->driver_rects)
+			spare[n++] = &ctx->driver_spans[(size_t)i * ctx->driver_spanCap];
+	}
+
+	s.spans = spare[0];
+	s.num = 0;
+	s.x = 0;
+	walkElmnts(ctx, prints, spanElm, &s);
+	if (ctx->errFlag)
+		return;
+
+	if (ctx->Yundercut > 0) {
+		n = intersectSpans(ctx->driver_rects, ctx->driver_numRects, s.spans, s.num, spare[1]);
+		vectorBand(ctx, spare[1], n, ctx->Yundercut);
+	}
+
+	lines = prints->height > ctx->Yundercut ? prints->height - ctx->Yundercut : 0;
+	vectorBand(ctx, s.spans, s.num, lines);
+
+}
+
+
+static void vectorFinalise(gs1_encoder *ctx) {
+
+	size_t len, xref;
+	int i;
+
+	for (i = 0; i < ctx->driver_numRects; i++)
+		vectorRect(ctx, &ctx->driver_rects[i], ctx->driver_y);
+	ctx->driver_numRects = 0;
+
+	switch (ctx->format) {
+	case gs1_encoder_dSVG:
+		emitf(ctx, "\"/>\n</svg>\n");
+		break;
+	case gs1_encoder_dEPS:
+		emitf(ctx, "showpage\n%%%%EOF\n");
+		break;
+	case gs1_encoder_dPDF:
+		len = ctx->driver_vecBytes - ctx->driver_pdfStream - 1;	// Final EOL precedes endstream
+		emitf(ctx, "endstream\nendobj\n");
+		ctx->driver_pdfObj[4] = ctx->driver_vecBytes;
+		emitf(ctx, "5 0 obj\n%lu\nendobj\n", (unsigned long)len);
+		xref = ctx->driver_vecBytes;
+		emitf(ctx, "xref\n0 6\n0000000000 65535 f \n");
+		for (i = 0; i < 5; i++)
+			emitf(ctx, "%010lu 00000 n \n", (unsigned long)ctx->driver_pdfObj[i]);
+		emitf(ctx, "trailer\n<< /Size 6 /Root 1 0 R >>\nstartxref\n%lu\n%%%%EOF\n", (unsigned long)xref);
+		break;
+	}
+
+}
+
+
+// Raster formats have a fixed size, so they are measured without rendering
+static bool sizeOnly(gs1_encoder *ctx) {
+	return ctx->measureOnly && !isVector(ctx->format) && ctx->format != gs1_encoder_dZPL;
+}
+
+
 bool gs1_doDriverInit(gs1_encoder *ctx, const long xdim, const long ydim) {
 
 	FILE* oFile;
+	size_t lineCap, spanCap, size, bw;
+
+	// Size the lines for a row padded to a long word, plus the overrun byte
+	lineCap = (size_t)(xdim + 31) / 32 * 4 + 1;
+	if (lineCap > MAX_LINE/8 + 1)
+		lineCap = MAX_LINE/8 + 1;
+	if (isVector(ctx->format)) {
+		// Runs of dark pixels are separated by light pixels
+		spanCap = (size_t)xdim / 2 + 2;
+		if (spanCap > MAX_LINE/2 + 2)
+			spanCap = MAX_LINE/2 + 2;
+		if (spanCap > ctx->driver_spanCap) {
+#ifndef NOMALLOC
+			free(ctx->driver_spans);
+			ctx->driver_spanCap = 0;
+			if ((ctx->driver_spans = gs1_scratch(ctx, NULL, 3 * spanCap * sizeof(struct driverSpan))) == NULL)
+				return false;
+			ctx->driver_spanCap = spanCap;
+#endif
+		}
+		ctx->driver_rects = ctx->driver_spans;
+		ctx->driver_numRects = 0;
+	} else if (lineCap > ctx->driver_lineCap) {
+#ifndef NOMALLOC
+		free(ctx->driver_line);
+		free(ctx->driver_lineUCut);
+		ctx->driver_lineCap = 0;
+		ctx->driver_lineUCut = NULL;
+		if ((ctx->driver_line = gs1_scratch(ctx, NULL, lineCap)) == NULL ||
+		    (ctx->driver_lineUCut = gs1_scratch(ctx, NULL, lineCap)) == NULL)
+			return false;
+		ctx->driver_lineCap = lineCap;
+#endif
+	}
 
-	if (strcmp(ctx->outFile, "") != 0) {
+	ctx->driver_y = 0;
+	ctx->driver_ydim = (int)ydim;
+
+	if (sizeOnly(ctx)) {
+		bw = (size_t)(xdim + 7) / 8;
+		switch (ctx->format) {
+		case gs1_encoder_dRAW:
+			ctx->driver_outSize = bw * (size_t)ydim;
+			break;
+		case gs1_encoder_dTIF:
+			ctx->driver_outSize = TIF_HDR_LEN + bw * (size_t)ydim;
+			break;
+		case gs1_encoder_dBMP:
+			ctx->driver_outSize = BMP_HDR_LEN + (size_t)((xdim+31)/32*4 * ydim);
+			break;
+		case gs1_encoder_dESCPOS:
+			ctx->driver_outSize = 8 * (size_t)((ydim + ESCPOS_BAND_LINES - 1) / ESCPOS_BAND_LINES) + bw * (size_t)ydim;
+			break;
+		}
+		return true;
+	} else if (ctx->measureOnly) {
+		// Other formats are rendered with the output only being counted
+	} else if (ctx->streamRows) {
+		// Rows are handed to the user instead of being accumulated
+		assert(ctx->format == gs1_encoder_dRAW);
+		ctx->bufferWidth = (int)xdim;
+		ctx->bufferHeight = (int)ydim;
+	} else if (!toBuffer(ctx)) {
 		if ((oFile = fopen(ctx->outFile, "wb")) == NULL) {
 			sprintf(ctx->errMsg, "Unable to open file: %s", ctx->outFile);
 			ctx->errFlag = true;
@@ -316,32 +883,55 @@ bool gs1_doDriverInit(gs1_encoder *ctx, const long xdim, const long ydim) {
 		}
 		ctx->outfp = oFile;
 	} else {
-		ctx->bufferCap = 1024;		// Initial size, will grow as needed
-		if ((ctx->buffer = malloc(ctx->bufferCap * sizeof(uint8_t))) == NULL) {
-			ctx->bufferCap = 0;
-			strcpy(ctx->errMsg, "Out of memory allocating output buffer");
-			ctx->errFlag = true;
-			return false;
+		if (ctx->bufferCap == 0) {	// Reuse any retained buffer
+			ctx->bufferCap = 1024;	// Initial size, will grow as needed
+			if ((ctx->buffer = malloc(ctx->bufferCap * sizeof(uint8_t))) == NULL) {
+				ctx->bufferCap = 0;
+				strcpy(ctx->errMsg, "Out of memory allocating output buffer");
+				ctx->errFlag = true;
+				return false;
+			}
 		}
 		ctx->bufferSize = 0;
 		ctx->bufferWidth = (int)xdim;
 		ctx->bufferHeight = (int)ydim;
 	}
 
-	if (ctx->format == gs1_encoder_dBMP) {
+	if (ctx->streamRows && !ctx->rowCallback) {
 		if ((ctx->driver_rowBuffer = malloc((unsigned long)ydim * sizeof(struct sPrints))) == NULL) {
-			strcpy(ctx->errMsg, "Out of memory creating initial BMP row buffer");
+			strcpy(ctx->errMsg, "Out of memory creating initial row buffer");
 			ctx->errFlag = true;
 			return false;
 		}
 		ctx->driver_numRows = 0;
+	}
 
+	if (ctx->format == gs1_encoder_dBMP) {
 		bmpHeader(ctx, xdim, ydim);
+		// Reserve the whole image so that rows can be placed as they arrive
+		size = BMP_HDR_LEN + (size_t)((xdim+31)/32*4 * ydim);
+		if (toBuffer(ctx) && !ctx->errFlag) {
+			if (!growBuffer(ctx, size - ctx->bufferSize))
+				return false;
+			ctx->bufferSize = size;
+		} else if (!ctx->errFlag) {
+			if ((ctx->driver_bmpImage = malloc(size - BMP_HDR_LEN)) == NULL) {
+				strcpy(ctx->errMsg, "Out of memory creating BMP image");
+				ctx->errFlag = true;
+				return false;
+			}
+			ctx->driver_bmpSize = size - BMP_HDR_LEN;
+		}
 	} else if (ctx->format == gs1_encoder_dTIF) {
 		tifHeader(ctx, xdim, ydim);
+	} else if (isVector(ctx->format)) {
+		vectorHeader(ctx, xdim, ydim);
+	} else if (ctx->format == gs1_encoder_dZPL) {
+		// Total bytes, repeated as the field count, then bytes per row
+		emitf(ctx, "^GFA,%ld,%ld,%ld,", (xdim+7)/8 * ydim, (xdim+7)/8 * ydim, (xdim+7)/8);
 	}
 
-	return true;
+	return !ctx->errFlag;
 
 }
 
@@ -350,19 +940,25 @@ bool gs1_doDriverAddRow(gs1_encoder *ctx, const struct sPrints *prints) {
 
 	struct sPrints *row;
 
-	if (ctx->format == gs1_encoder_dBMP) {
+	if (sizeOnly(ctx)) {
+
+		// Nothing to render
+
+	} else if (ctx->driver_rowBuffer) {  // Pulled rows
 
 		// Buffer the row and its pattern
 		row = &ctx->driver_rowBuffer[ctx->driver_numRows++];
 		memcpy(row, prints, sizeof(struct sPrints));
 		if ((row->pattern = malloc((unsigned int)prints->elmCnt * sizeof(uint8_t))) == NULL) {
-			strcpy(ctx->errMsg, "Out of memory extending BMP row buffer");
+			strcpy(ctx->errMsg, "Out of memory extending row buffer");
 			ctx->errFlag = true;
 			return false;
 		}
 		memcpy(row->pattern, prints->pattern, (unsigned int)prints->elmCnt * sizeof(uint8_t));
 
-	} else {  // TIF and RAW
+	} else if (isVector(ctx->format)) {
+		vectorRow(ctx, prints);
+	} else {  // Raster formats and pushed rows
 		// Directly emit the row
 		printElmnts(ctx, prints);
 	}
@@ -375,25 +971,33 @@ bool gs1_doDriverAddRow(gs1_encoder *ctx, const struct sPrints *prints) {
 bool gs1_doDriverFinalise(gs1_encoder *ctx) {
 
 	uint8_t* buf;
-	int i;
 
-	if (ctx->format == gs1_encoder_dBMP) {
-		// Emit the rows in reverse, releasing their patterns
-		for (i = ctx->driver_numRows - 1; i >= 0; i--) {
-			printElmnts(ctx, &ctx->driver_rowBuffer[i]);
-			free(ctx->driver_rowBuffer[i].pattern);
-		}
+	if (sizeOnly(ctx))
+		return true;
 
-		free(ctx->driver_rowBuffer);
-		ctx->driver_rowBuffer = NULL;
+	if (isVector(ctx->format)) {
+		vectorFinalise(ctx);
+	} else if (ctx->format == gs1_encoder_dZPL) {
+		emitf(ctx, "^FS\n");
 	}
 
-	if (strcmp(ctx->outFile, "") != 0) {
+	if (ctx->streamRows) {
+		// Buffered rows are rendered as they are pulled
+		ctx->driver_pullRow = 0;
+		ctx->driver_pullRep = 0;
+		ctx->driver_pullReps = 0;
+	} else if (ctx->measureOnly) {
+		// Nothing was opened or stored
+	} else if (!toBuffer(ctx)) {
+		if (ctx->driver_bmpImage)
+			fwrite(ctx->driver_bmpImage, ctx->driver_bmpSize, 1, ctx->outfp);
+		gs1_driverFreeRows(ctx);
 		fclose(ctx->outfp);
-	} else {
+	} else if (!ctx->retainBuffer && !ctx->userBuffer) {
 		// Shrink the buffer to fit the data
 		if ((buf = realloc(ctx->buffer, ctx->bufferSize * sizeof(uint8_t))) == NULL) {
 			free(ctx->buffer);
+			ctx->buffer = NULL;
 			ctx->bufferCap = 0;
 			ctx->bufferSize = 0;
 			strcpy(ctx->errMsg, "Failed to shrink output buffer");
@@ -409,6 +1013,89 @@ bool gs1_doDriverFinalise(gs1_encoder *ctx) {
 }
 
 
+/*
+ *  A module matrix is already laid out as a RAW image at one pixel per
+ *  module, so in module mode it is copied directly to the buffer.
+ *
+ */
+bool gs1_doDriverMatrix(gs1_encoder *ctx, const uint8_t *mtx, const int cols, const int rows) {
+
+	size_t size = (size_t)((cols-1)/8+1) * (size_t)rows;
+
+	assert(ctx->moduleMode);
+
+	ctx->bufferSize = 0;
+	if (!growBuffer(ctx, size))
+		return false;
+
+	memcpy(ctx->buffer, mtx, size);
+	ctx->bufferSize = size;
+	ctx->bufferWidth = cols;
+	ctx->bufferHeight = rows;
+
+	return true;
+
+}
+
+
+/*
+ *  Render the next raster line of the rows that were retained for pulling,
+ *  returning its length, or zero once all lines have been returned.
+ *
+ */
+size_t gs1_driverNextRow(gs1_encoder *ctx, const uint8_t **row) {
+
+	const struct sPrints *prints;
+	int ndx;
+
+	*row = NULL;
+
+	if (!ctx->driver_rowBuffer)
+		return 0;
+
+	while (ctx->driver_pullRep >= ctx->driver_pullReps) {
+		if (ctx->driver_pullRow >= ctx->driver_numRows) {
+			gs1_driverFreeRows(ctx);
+			return 0;
+		}
+		prints = &ctx->driver_rowBuffer[ctx->driver_pullRow++];
+		if ((ndx = renderRow(ctx, prints)) < 0) {
+			gs1_driverFreeRows(ctx);
+			return 0;
+		}
+		ctx->driver_pullLen = (size_t)ndx;
+		ctx->driver_pullRep = 0;
+		ctx->driver_pullReps = prints->height > ctx->Yundercut ? prints->height : ctx->Yundercut;
+	}
+
+	*row = ctx->driver_pullRep < ctx->Yundercut ? ctx->driver_lineUCut : ctx->driver_line;
+	ctx->driver_pullRep++;
+
+	return ctx->driver_pullLen;
+
+}
+
+
+// Release any rows that are buffered but not yet rendered or written
+void gs1_driverFreeRows(gs1_encoder *ctx) {
+
+	int i;
+
+	free(ctx->driver_bmpImage);
+	ctx->driver_bmpImage = NULL;
+
+	if (!ctx->driver_rowBuffer)
+		return;
+
+	for (i = 0; i < ctx->driver_numRows; i++)
+		free(ctx->driver_rowBuffer[i].pattern);
+	free(ctx->driver_rowBuffer);
+	ctx->driver_rowBuffer = NULL;
+	ctx->driver_numRows = 0;
+
+}
+
+
 // Find pixMult that produces X dimension closest to target, within optional constraints
 static int findPixMultForConstraints(gs1_encoder *ctx) {
 
@@ -22,6 +22,8 @@
 #define UTIL_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "qr.h"
 #include "enc-private.h"
@@ -30,6 +32,13 @@
 #define MAX_LINE (MAX_QR_SIZE * MAX_PIXMULT)
 #define DEFAULT_BMP_FILE "out.bmp"
 #define DEFAULT_TIF_FILE "out.tif"
+#define DEFAULT_SVG_FILE "out.svg"
+#define DEFAULT_EPS_FILE "out.eps"
+#define DEFAULT_PDF_FILE "out.pdf"
+#define DEFAULT_ZPL_FILE "out.zpl"
+#define DEFAULT_ESCPOS_FILE "out.prn"
+
+#define ESCPOS_BAND_LINES 256	// Raster lines sent with each GS v 0 command
 
 struct sPrints;
 
@@ -49,9 +58,17 @@ struct sPrints;
 		return;			\
 } while(0)
 
+#define gs1_driverMatrix(ctx, mtx, cols, rows) do {	\
+	if (!gs1_doDriverMatrix(ctx, mtx, cols, rows))	\
+		return;					\
+} while(0)
+
 bool gs1_doDriverInit(gs1_encoder *ctx, long xdim, long ydim);
 bool gs1_doDriverAddRow(gs1_encoder *ctx, const struct sPrints *prints);
 bool gs1_doDriverFinalise(gs1_encoder *ctx);
+bool gs1_doDriverMatrix(gs1_encoder *ctx, const uint8_t *mtx, int cols, int rows);
+size_t gs1_driverNextRow(gs1_encoder *ctx, const uint8_t **row);
+void gs1_driverFreeRows(gs1_encoder *ctx);
 bool gs1_setXdimension(gs1_encoder *ctx, double minX, double targetX, double maxX);
 
 #endif /* UTIL_H */
@@ -46,6 +46,14 @@ struct sPrints {
 };
 
 
+// A run of dark pixels in a raster line, or a rectangle of them from line y
+struct driverSpan {
+	int x;
+	int w;
+	int y;
+};
+
+
 #define SIZEOF_ARRAY(x) (sizeof(x) / sizeof(x[0]))
 
 
@@ -56,6 +64,7 @@ struct sPrints {
 #include "ai.h"
 #include "mtx.h"
 #include "qr.h"
+#include "rs.h"
 #include "rss14.h"
 #include "rssexp.h"
 #include "rsslim.h"
@@ -76,6 +85,7 @@ struct gs1_encoder {
 	int Yundercut;				// Y pixels to undercut
 	bool addCheckDigit;			// For EAN/UPC and RSS-14/Lim, calculated if true, otherwise validated
 	bool permitUnknownAIs;			// Extract AIs that are not in our AI table during AI element string and DL URI parsing
+	bool validateAIassociations;		// Apply the requisite and invalid pair rules to the extracted AIs
 	int sepHt;				// Separator row height
 	int dataBarExpandedSegmentsWidth;	// Number of segments for RSS Expdanded (Stacked)
 	int gs1_128LinearHeight;		// Height of UCC/EAN-128 in X
@@ -83,41 +93,71 @@ struct gs1_encoder {
 	int dmCols;				// Data Matrix fixed number of columns
 	int qrVersion;				// QR Code fixed symbol version
 	int qrEClevel;				// QR Code error correction level
+	int qrMaskStrategy;			// QR Code mask selection strategy
+	int qrMask;				// QR Code mask for the fixed strategy
 	int format;				// BMP, TIF or RAW
 	bool fileInputFlag;			// True is dataFile else dataStr
 	char dataStr[MAX_DATA+1];		// Input data buffer passed to the encoders
-	char dlAIbuffer[MAX_DATA+1];		// Populated with unbracketed AI string extracted from DL input
+	char *dlAIbuffer;			// Populated with unbracketed AI string extracted from DL input
 	char dataFile[MAX_FNAME+1];
 	char outFile[MAX_FNAME+1];
+	char syntaxDictFile[MAX_FNAME+1];	// Compiled syntax dictionary, or empty for the built-in AI table
 	uint8_t *buffer;			// We may allocate an output buffer
 	int bufferWidth;			// Width of a raw format buffer
 	int bufferHeight;			// Height of a raw format buffer
+	bool retainBuffer;			// Keep the output buffer allocation between encodes
+	bool userBuffer;			// Output buffer is provided by the user
+	bool measureOnly;			// Count the output bytes without storing them
+	bool streamRows;			// Deliver RAW rows individually rather than in a buffer
+	gs1_encoder_rowCallback rowCallback;	// Receives each streamed row, else they are pulled
+	void *rowCallbackData;
+	bool moduleMode;			// Render one pixel per module into the buffer
 	char **bufferStrings;			// We may allocate output as a set of strings
-	char outStr[2*MAX_DATA+1];		// Buffer to return formatted HRI data
+	char *outStr;				// Buffer to return formatted HRI data
 	char *outHRI[MAX_AIS];			// Array of AI element string for HRI printing
 	char VERSION[16];
 
 	// per-instance globals
 	bool localAlloc;			// True if we malloc()ed this struct
 	FILE *outfp;
+	const struct aiEntry *aiTable;		// AI table in use, either built in or loaded
+	const uint16_t *aiIndex;		// First entry of each group of AIs in the table
+	uint16_t aiTableSize;
+	const struct aiAssoc *aiAssoc;		// AI association rules that accompany the AI table
+	uint16_t aiAssocSize;
+	void *syntaxDict;			// Private copy of the loaded syntax dictionary, if any
 	struct aiValue aiData[MAX_AIS];		// List of AI components
 	int numAIs;
 	size_t bufferCap;
 	size_t bufferSize;
 	int errFlag;
-	char errMsg[512];
+	char errMsg[512];			// Empty until read when the error has a code
+	int errCode;				// enum gs1_encoder_errCodes
+	char errAI[MAX_AI_LEN+1];
+	char errPairAI[MAX_AI_LEN+1];		// Other AI of an invalid pair
+	int errOffset;				// Within the AI value, or -1
 	int line1;
 	int linFlag;				// Tells pack whether linear or cc is being encoded
 	int colCnt;				// After set, may be decreased by getUnusedBitCnt
 	int rowCnt;				// Determined by getUnusedBitCnt
 	int eccCnt;				// Determined by getUnusedBitCnt
-	uint8_t ccPattern[MAX_CCB4_ROWS][CCB4_ELMNTS];
 	const int *cc_CCSizes;	// will point to CCxSize
-	int cc_gpa[512];
-	uint8_t driver_line[MAX_LINE/8 + 1];
-	uint8_t driver_lineUCut[MAX_LINE/8 + 1];
 	struct sPrints *driver_rowBuffer;
 	int driver_numRows;
+	int driver_pullRow;			// Next buffered row to be rendered for gs1_encoder_nextRow()
+	int driver_pullRep;			// Raster lines of the current row already returned
+	int driver_pullReps;			// Raster lines for the current row
+	size_t driver_pullLen;			// Length of the rendered raster line
+	size_t driver_outSize;			// Bytes of output counted when measuring
+	struct driverSpan *driver_rects;	// Rectangles of a vector image still open
+	int driver_numRects;
+	int driver_y;				// Next raster line of the image
+	int driver_ydim;
+	uint8_t *driver_bmpImage;		// BMP lines awaiting output to a file
+	size_t driver_bmpSize;
+	size_t driver_vecBytes;			// Vector output emitted so far
+	size_t driver_pdfObj[5];		// Offsets of the PDF objects
+	size_t driver_pdfStream;		// Offset of the PDF content stream
 	struct sPrints rss14_prntSep;
 	uint8_t rss14_sepPattern[RSS14_SYM_W/2+2];
 	int rssexp_rowWidth;
@@ -126,17 +166,58 @@ struct gs1_encoder {
 	struct sPrints rssutil_prntSep;
 	uint8_t rssutil_sepPattern[MAX_SEP_ELMNTS];
 	int rss_util_widths[MAX_K];
-	uint8_t ucc128_patCCC[UCC128_MAX_PAT];
+
+	/*
+	 * Large working areas that are only needed by certain symbologies or
+	 * functions. These are allocated on first use, sized for the request,
+	 * and retained for the lifetime of the instance. See gs1_scratch().
+	 *
+	 */
+	uint8_t (*ccPattern)[CCB4_ELMNTS];	// MAX_CCB4_ROWS rows
+	int *cc_gpa;				// CC_GPA_SIZE entries
+	uint8_t *driver_line;
+	uint8_t *driver_lineUCut;
+	size_t driver_lineCap;			// Allocated length of each driver line
+	struct driverSpan *driver_spans;	// Three sets of driver_spanCap spans
+	size_t driver_spanCap;
+	uint8_t *ucc128_patCCC;			// UCC128_MAX_PAT entries
+	struct qrLayout *qr_layout;		// Retained between QR Code encodes
+	struct gs1_rsCode *rs_code;		// Retained between matrix symbol encodes
 
 	// Ephemeral working space that can never clash
 	union {
-		struct patternLength qr_pats[MAX_QR_SIZE];
-		struct patternLength dm_pats[MAX_DM_ROWS];
+		struct patternLength *qr_pats;
+		struct patternLength *dm_pats;
 	};
+	int patsCap;				// Allocated number of pattern rows
+
+#ifdef NOMALLOC
+	// Without a heap the working areas are carved from the instance itself
+	struct {
+		char dlAIbuffer[MAX_DATA+1];
+		char outStr[2*MAX_DATA+1];
+		uint8_t ccPattern[MAX_CCB4_ROWS][CCB4_ELMNTS];
+		int cc_gpa[CC_GPA_SIZE];
+		uint8_t driver_line[MAX_LINE/8 + 1];
+		uint8_t driver_lineUCut[MAX_LINE/8 + 1];
+		struct driverSpan driver_spans[3][MAX_LINE/2 + 2];
+		uint8_t ucc128_patCCC[UCC128_MAX_PAT];
+		struct qrLayout qr_layout;
+		struct gs1_rsCode rs_code;
+		union {
+			struct patternLength qr_pats[MAX_QR_SIZE];
+			struct patternLength dm_pats[MAX_DM_ROWS];
+		};
+	} store;
+#endif
 
 };
 
 
+void* gs1_scratch(gs1_encoder *ctx, void *region, size_t size);
+void gs1_setError(gs1_encoder *ctx, int code, const char *ai, size_t ailen, int offset);
+
+
 #ifdef UNIT_TESTS
 
 void test_api_getVersion(void);
@@ -158,11 +239,14 @@ void test_api_linHeight(void);
 void test_api_dmRowsColumns(void);
 void test_api_qrVersion(void);
 void test_api_qrEClevel(void);
+void test_api_qrMaskStrategy(void);
 void test_api_addCheckDigit(void);
 void test_api_permitUnknownAIs(void);
+void test_api_validateAIassociations(void);
 void test_api_outFile(void);
 void test_api_dataFile(void);
 void test_api_dataStr(void);
+void test_api_setAIs(void);
 void test_api_getAIdataStr(void);
 void test_api_getScanData(void);
 void test_api_setScanData(void);
@@ -170,6 +254,16 @@ void test_api_getHRI(void);
 void test_api_format(void);
 void test_api_getBuffer(void);
 void test_api_copyOutputBuffer(void);
+void test_api_encodeBatch(void);
+void test_api_scratch(void);
+void test_api_streamRows(void);
+void test_api_encodeModules(void);
+void test_api_vectorFormats(void);
+void test_api_printerFormats(void);
+void test_api_bmpFormat(void);
+void test_api_outputBuffer(void);
+void test_api_checkDigits(void);
+void test_api_errCodes(void);
 void test_api_copyHRI(void);
 
 #endif
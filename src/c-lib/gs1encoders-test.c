@@ -57,7 +57,10 @@
 #include "ean.h"
 #include "ai.h"
 #include "dl.h"
+#include "pool.h"
+#include "syntaxdict.h"
 #include "qr.h"
+#include "rs.h"
 #include "rss14.h"
 #include "rssexp.h"
 #include "rsslim.h"
@@ -176,11 +179,14 @@ TEST_LIST = {
     { "api_dmRowsColumns", test_api_dmRowsColumns },
     { "api_qrVersion", test_api_qrVersion },
     { "api_qrEClevel", test_api_qrEClevel },
+    { "api_qrMaskStrategy", test_api_qrMaskStrategy },
     { "api_addCheckDigit", test_api_addCheckDigit },
     { "api_permitUnknownAIs", test_api_permitUnknownAIs },
+    { "api_validateAIassociations", test_api_validateAIassociations },
     { "api_outFile", test_api_outFile },
     { "api_dataFile", test_api_dataFile },
     { "api_dataStr", test_api_dataStr },
+    { "api_setAIs", test_api_setAIs },
     { "api_getAIdataStr", test_api_getAIdataStr },
     { "api_getScanData", test_api_getScanData },
     { "api_setScanData", test_api_setScanData },
@@ -188,6 +194,16 @@ TEST_LIST = {
     { "api_format", test_api_format },
     { "api_getBuffer", test_api_getBuffer },
     { "api_copyOutputBuffer", test_api_copyOutputBuffer },
+    { "api_encodeBatch", test_api_encodeBatch },
+    { "api_scratch", test_api_scratch },
+    { "api_streamRows", test_api_streamRows },
+    { "api_encodeModules", test_api_encodeModules },
+    { "api_vectorFormats", test_api_vectorFormats },
+    { "api_printerFormats", test_api_printerFormats },
+    { "api_bmpFormat", test_api_bmpFormat },
+    { "api_outputBuffer", test_api_outputBuffer },
+    { "api_checkDigits", test_api_checkDigits },
+    { "api_errCodes", test_api_errCodes },
     { "api_copyHRI", test_api_copyHRI },
 
 
@@ -196,11 +212,16 @@ TEST_LIST = {
      *
      */
     { "ai_lookupAIentry", test_ai_lookupAIentry },
+    { "ai_lookupAIindex", test_ai_lookupAIindex },
+    { "syntaxdict_load", test_syntaxdict_load },
     { "ai_AItableVsPrefixLength", test_ai_AItableVsPrefixLength },
     { "ai_gs1_parseAIdata", test_ai_parseAIdata },
     { "ai_gs1_processAIdata", test_ai_processAIdata },
     { "ai_validateParity", test_ai_validateParity },
     { "ai_lint_csumalpha", test_ai_lint_csumalpha },
+    { "ai_validateComponent", test_ai_validateComponent },
+    { "ai_charClass", test_ai_charClass },
+    { "ai_validateAIassociations", test_ai_validateAIassociations },
 
 
     /*
@@ -269,6 +290,13 @@ TEST_LIST = {
     { "rssexp_RSSEXP_encode", test_rssexp_RSSEXP_encode },
 
 
+    /*
+     * pool.c
+     *
+     */
+    { "pool_encodeBatch", test_pool_encodeBatch },
+
+
     /*
      * qr.c
      *
@@ -277,7 +305,17 @@ TEST_LIST = {
     { "qr_QR_versions", test_qr_QR_versions },
 #endif
     { "qr_QR_fixtures", test_qr_QR_fixtures },
+    { "qr_QR_segments", test_qr_QR_segments },
+    { "qr_QR_rleWords", test_qr_QR_rleWords },
     { "qr_QR_encode", test_qr_QR_encode },
+    { "qr_QR_maskStrategy", test_qr_QR_maskStrategy },
+
+
+    /*
+     * rs.c
+     *
+     */
+    { "rs_encode", test_rs_encode },
 
 
     /*
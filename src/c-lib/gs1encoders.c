@@ -36,6 +36,7 @@
 #include "rssexp.h"
 #include "rsslim.h"
 #include "scandata.h"
+#include "syntaxdict.h"
 #include "ucc128.h"
 #include "qr.h"
 
@@ -44,6 +45,80 @@ static void reset_error(gs1_encoder *ctx) {
 	assert(ctx);
 	ctx->errFlag = false;
 	ctx->errMsg[0] = '\0';
+	ctx->errCode = gs1_encoder_eNONE;
+	ctx->errAI[0] = '\0';
+	ctx->errPairAI[0] = '\0';
+	ctx->errOffset = -1;
+}
+
+
+/*
+ *  Messages for the errors that have a code, formatted with the AI when the
+ *  message is first read
+ *
+ */
+static const char *errFormats[gs1_encoder_eNUMERRCODES] = {
+	[gs1_encoder_eTOO_MANY_AIS]			= "Too many AIs",
+	[gs1_encoder_eMISSING_FNC1_IN_FIRST]		= "Missing FNC1 in first position",
+	[gs1_encoder_eAI_DATA_EMPTY]			= "The AI data is empty",
+	[gs1_encoder_eAI_PARSE_FAILED]			= "Failed to parse AI data",
+	[gs1_encoder_eAI_UNRECOGNISED]			= "Unrecognised AI: %s",
+	[gs1_encoder_eAI_NO_KNOWN_PREFIX]		= "No known AI is a prefix of: %s...",
+	[gs1_encoder_eAI_VALUE_EMPTY]			= "AI (%s) data is empty",
+	[gs1_encoder_eAI_VALUE_TOO_SHORT]		= "AI (%s) value is too short",
+	[gs1_encoder_eAI_VALUE_TOO_LONG]		= "AI (%s) value is too long",
+	[gs1_encoder_eAI_COMPONENT_TOO_SHORT]		= "AI (%s) data is too short",
+	[gs1_encoder_eAI_DATA_TOO_LONG]			= "AI (%s) data is too long",
+	[gs1_encoder_eAI_ILLEGAL_CARET]			= "AI (%s) contains illegal ^ character",
+	[gs1_encoder_eAI_NON_DIGIT]			= "AI (%s): Illegal non-digit character",
+	[gs1_encoder_eAI_CSET82]			= "AI (%s): Incorrect CSET 82 character",
+	[gs1_encoder_eAI_CHECK_DIGIT]			= "AI (%s): Incorrect check digit",
+	[gs1_encoder_eAI_CSUMALPHA_TOO_SHORT]		= "AI (%s): Alphanumeric string is too short to check",
+	[gs1_encoder_eAI_CSUMALPHA_TOO_LONG]		= "AI (%s): Alphanumeric string is too long to check",
+	[gs1_encoder_eAI_CSUMALPHA_CHECK]		= "AI (%s): Bad alphanumeric check characters",
+	[gs1_encoder_eDL_PARSE_FAILED]			= "Failed to parse DL data",
+	[gs1_encoder_eDL_ILLEGAL_CHARACTER]		= "URI contains illegal characters",
+	[gs1_encoder_eDL_SCHEME]			= "Scheme must be http:// or https://",
+	[gs1_encoder_eDL_NO_PATH_INFO]			= "URI must contain a domain and path info",
+	[gs1_encoder_eDL_NO_KEYS]			= "No GS1 DL keys found in path info",
+	[gs1_encoder_eDL_PATH_VALUE_TOO_LONG]		= "Decoded AI (%s) from DL path info too long",
+	[gs1_encoder_eDL_QUERY_UNKNOWN_AI]		= "Unknown AI (%s) in query parameters",
+	[gs1_encoder_eDL_QUERY_VALUE_TOO_LONG]		= "Decoded AI (%s) value from DL query params too long",
+	[gs1_encoder_eSCAN_MISSING_SYMBOLOGY_ID]	= "Missing symbology identifier",
+	[gs1_encoder_eSCAN_UNSUPPORTED_SYMBOLOGY_ID]	= "Unsupported symbology identifier",
+	[gs1_encoder_eSCAN_PRIMARY_TOO_SHORT]		= "Primary scan data is too short",
+	[gs1_encoder_eSCAN_PRIMARY_TOO_LONG]		= "Primary message is too short",
+	[gs1_encoder_eSCAN_PRIMARY_NON_DIGIT]		= "Primary message number only contain digits",
+	[gs1_encoder_eSCAN_PRIMARY_CHECK_DIGIT]		= "Primary message check digit is incorrect",
+	[gs1_encoder_eSCAN_ILLEGAL_CARET]		= "Scan data contains illegal ^ character",
+	[gs1_encoder_eAI_REQUISITE_MISSING]		= "Required AIs for AI (%s) are not satisfied",
+	[gs1_encoder_eAI_INVALID_PAIR]			= "It is invalid to pair AI (%s) with AI (%s)",
+	[gs1_encoder_eAI_CSET39]			= "AI (%s): Incorrect CSET 39 character",
+};
+
+
+/*
+ *  Record an error by its code, deferring the formatting of its message
+ *  until it is read
+ *
+ */
+void gs1_setError(gs1_encoder *ctx, const int code, const char *ai, size_t ailen, const int offset) {
+
+	assert(ctx);
+	assert(code > gs1_encoder_eOTHER && code < gs1_encoder_eNUMERRCODES);
+	assert(ai || ailen == 0);
+
+	if (ailen > MAX_AI_LEN)
+		ailen = MAX_AI_LEN;
+	if (ailen)
+		memcpy(ctx->errAI, ai, ailen);
+	ctx->errAI[ailen] = '\0';
+	ctx->errPairAI[0] = '\0';
+	ctx->errCode = code;
+	ctx->errOffset = offset;
+	ctx->errMsg[0] = '\0';
+	ctx->errFlag = true;
+
 }
 
 
@@ -62,6 +137,110 @@ static void free_bufferStrings(gs1_encoder *ctx) {
 }
 
 
+/*
+ *  Return the given working area, allocating it if this is its first use. On
+ *  failure an error is set and NULL is returned.
+ *
+ */
+void* gs1_scratch(gs1_encoder *ctx, void *region, const size_t size) {
+
+	assert(ctx);
+
+	if (region)
+		return region;
+
+#ifndef NOMALLOC
+	region = malloc(size);
+#else
+	(void)size;
+#endif
+	if (!region) {
+		strcpy(ctx->errMsg, "Out of memory allocating working space");
+		ctx->errFlag = true;
+	}
+
+	return region;
+
+}
+
+
+static void free_scratch(gs1_encoder *ctx) {
+	assert(ctx);
+#ifndef NOMALLOC
+	free(ctx->dlAIbuffer);
+	free(ctx->outStr);
+	free(ctx->ccPattern);
+	free(ctx->cc_gpa);
+	free(ctx->driver_line);
+	free(ctx->driver_lineUCut);
+	free(ctx->driver_spans);
+	free(ctx->ucc128_patCCC);
+	free(ctx->qr_layout);
+	free(ctx->rs_code);
+	free(ctx->qr_pats);
+#endif
+}
+
+
+static bool alloc_symScratch(gs1_encoder *ctx) {
+
+	int pats = 0;
+
+	assert(ctx);
+
+	switch (ctx->sym) {
+		case gs1_encoder_sQR:
+			pats = MAX_QR_SIZE;
+			if (!ctx->qr_layout) {
+				if ((ctx->qr_layout = gs1_scratch(ctx, ctx->qr_layout, sizeof(struct qrLayout))) == NULL)
+					return false;
+				ctx->qr_layout->version = 0;
+			}
+			break;
+		case gs1_encoder_sDM:
+			pats = MAX_DM_ROWS;
+			break;
+		case gs1_encoder_sGS1_128_CCC:
+			if ((ctx->ucc128_patCCC = gs1_scratch(ctx, ctx->ucc128_patCCC, UCC128_MAX_PAT)) == NULL)
+				return false;
+			break;
+		default:
+			break;
+	}
+
+	// Reed Solomon code for the matrix symbologies, kept for later symbols
+	if (pats && !ctx->rs_code) {
+		if ((ctx->rs_code = gs1_scratch(ctx, ctx->rs_code, sizeof(struct gs1_rsCode))) == NULL)
+			return false;
+		ctx->rs_code->ecclen = 0;
+	}
+
+	// Pattern rows for the matrix symbologies, grown if a larger symbology is later selected
+	if (!ctx->moduleMode && pats > ctx->patsCap) {
+#ifndef NOMALLOC
+		free(ctx->qr_pats);
+		ctx->qr_pats = NULL;
+#endif
+		if ((ctx->qr_pats = gs1_scratch(ctx, ctx->qr_pats, (size_t)pats * sizeof(struct patternLength))) == NULL) {
+			ctx->patsCap = 0;
+			return false;
+		}
+		ctx->patsCap = pats;
+	}
+
+	// Composite component
+	if (strchr(ctx->dataStr, '|') != NULL) {
+		if ((ctx->ccPattern = gs1_scratch(ctx, ctx->ccPattern, MAX_CCB4_ROWS * CCB4_ELMNTS)) == NULL)
+			return false;
+		if ((ctx->cc_gpa = gs1_scratch(ctx, ctx->cc_gpa, CC_GPA_SIZE * sizeof(int))) == NULL)
+			return false;
+	}
+
+	return true;
+
+}
+
+
 GS1_ENCODERS_API size_t gs1_encoder_instanceSize(void) {
 	return sizeof(struct gs1_encoder);
 }
@@ -120,11 +299,17 @@ GS1_ENCODERS_API gs1_encoder* gs1_encoder_init(void *mem) {
 	ctx->dmCols = 0;
 	ctx->qrEClevel = gs1_encoder_qrEClevelM;
 	ctx->qrVersion = 0;  // Automatic
+	ctx->qrMaskStrategy = gs1_encoder_qrMaskEvaluate;
+	ctx->qrMask = 0;
 	ctx->addCheckDigit = false;
 	ctx->permitUnknownAIs = false;
+	ctx->validateAIassociations = false;
 	ctx->format = gs1_encoder_dTIF;
 	strcpy(ctx->dataStr, "");
 	ctx->numAIs = 0;
+	ctx->syntaxDict = NULL;
+	strcpy(ctx->syntaxDictFile, "");
+	gs1_setBuiltinAItable(ctx);
 	strcpy(ctx->dataFile, "data.txt");
 	ctx->fileInputFlag = false; // for kbd input
 	strcpy(ctx->outFile, DEFAULT_TIF_FILE);
@@ -133,7 +318,50 @@ GS1_ENCODERS_API gs1_encoder* gs1_encoder_init(void *mem) {
 	ctx->bufferCap = 0;
 	ctx->bufferWidth = 0;
 	ctx->bufferHeight = 0;
+	ctx->retainBuffer = false;
+	ctx->userBuffer = false;
+	ctx->measureOnly = false;
+	ctx->streamRows = false;
+	ctx->rowCallback = NULL;
+	ctx->rowCallbackData = NULL;
+	ctx->moduleMode = false;
+	ctx->driver_rowBuffer = NULL;
+	ctx->driver_numRows = 0;
+	ctx->driver_bmpImage = NULL;
 	ctx->bufferStrings = NULL;
+#ifndef NOMALLOC
+	ctx->dlAIbuffer = NULL;
+	ctx->outStr = NULL;
+	ctx->ccPattern = NULL;
+	ctx->cc_gpa = NULL;
+	ctx->driver_line = NULL;
+	ctx->driver_lineUCut = NULL;
+	ctx->driver_lineCap = 0;
+	ctx->driver_spans = NULL;
+	ctx->driver_spanCap = 0;
+	ctx->ucc128_patCCC = NULL;
+	ctx->qr_layout = NULL;
+	ctx->rs_code = NULL;
+	ctx->qr_pats = NULL;
+	ctx->patsCap = 0;
+#else
+	ctx->dlAIbuffer = ctx->store.dlAIbuffer;
+	ctx->outStr = ctx->store.outStr;
+	ctx->ccPattern = ctx->store.ccPattern;
+	ctx->cc_gpa = ctx->store.cc_gpa;
+	ctx->driver_line = ctx->store.driver_line;
+	ctx->driver_lineUCut = ctx->store.driver_lineUCut;
+	ctx->driver_lineCap = sizeof(ctx->store.driver_line);
+	ctx->driver_spans = *ctx->store.driver_spans;
+	ctx->driver_spanCap = SIZEOF_ARRAY(ctx->store.driver_spans[0]);
+	ctx->ucc128_patCCC = ctx->store.ucc128_patCCC;
+	ctx->qr_layout = &ctx->store.qr_layout;
+	ctx->qr_layout->version = 0;
+	ctx->rs_code = &ctx->store.rs_code;
+	ctx->rs_code->ecclen = 0;
+	ctx->qr_pats = ctx->store.qr_pats;
+	ctx->patsCap = MAX_QR_SIZE > MAX_DM_ROWS ? MAX_QR_SIZE : MAX_DM_ROWS;
+#endif
 	return ctx;
 
 }
@@ -143,7 +371,11 @@ GS1_ENCODERS_API void gs1_encoder_free(gs1_encoder *ctx) {
 	assert(ctx);
 	reset_error(ctx);
 	free_bufferStrings(ctx);
-	free(ctx->buffer);
+	if (!ctx->userBuffer)
+		free(ctx->buffer);
+	gs1_driverFreeRows(ctx);
+	free_scratch(ctx);
+	gs1_freeSyntaxDict(ctx);
 	if (ctx->localAlloc)
 		free(ctx);
 }
@@ -537,6 +769,50 @@ GS1_ENCODERS_API bool gs1_encoder_setQrEClevel(gs1_encoder *ctx, const int ecLev
 }
 
 
+GS1_ENCODERS_API int gs1_encoder_getQrMaskStrategy(gs1_encoder *ctx) {
+	assert(ctx);
+	reset_error(ctx);
+	return ctx->qrMaskStrategy;
+}
+GS1_ENCODERS_API bool gs1_encoder_setQrMaskStrategy(gs1_encoder *ctx, const int strategy) {
+	assert(ctx);
+	reset_error(ctx);
+	switch (strategy) {
+		case gs1_encoder_qrMaskEvaluate:
+		case gs1_encoder_qrMaskFast:
+		case gs1_encoder_qrMaskFixed:
+			ctx->qrMaskStrategy = strategy;
+			break;
+		default:
+			sprintf(ctx->errMsg, "Valid QR Code mask strategy values are evaluate=%d, fast=%d, fixed=%d",
+				gs1_encoder_qrMaskEvaluate,
+				gs1_encoder_qrMaskFast,
+				gs1_encoder_qrMaskFixed);
+			ctx->errFlag = true;
+			return false;
+	}
+	return true;
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_getQrMask(gs1_encoder *ctx) {
+	assert(ctx);
+	reset_error(ctx);
+	return ctx->qrMask;
+}
+GS1_ENCODERS_API bool gs1_encoder_setQrMask(gs1_encoder *ctx, const int mask) {
+	assert(ctx);
+	reset_error(ctx);
+	if (mask < 0 || mask > 7) {
+		strcpy(ctx->errMsg, "Valid QR Code mask values are 0 to 7");
+		ctx->errFlag = true;
+		return false;
+	}
+	ctx->qrMask = mask;
+	return true;
+}
+
+
 GS1_ENCODERS_API bool gs1_encoder_getAddCheckDigit(gs1_encoder *ctx) {
 	assert(ctx);
 	reset_error(ctx);
@@ -563,6 +839,43 @@ GS1_ENCODERS_API bool gs1_encoder_setPermitUnknownAIs(gs1_encoder *ctx, const bo
 }
 
 
+GS1_ENCODERS_API bool gs1_encoder_getValidateAIassociations(gs1_encoder *ctx) {
+	assert(ctx);
+	reset_error(ctx);
+	return ctx->validateAIassociations;
+}
+GS1_ENCODERS_API bool gs1_encoder_setValidateAIassociations(gs1_encoder *ctx, const bool validateAIassociations) {
+	assert(ctx);
+	reset_error(ctx);
+	ctx->validateAIassociations = validateAIassociations;
+	return true;
+}
+
+
+GS1_ENCODERS_API char* gs1_encoder_getSyntaxDictionary(gs1_encoder *ctx) {
+	assert(ctx);
+	reset_error(ctx);
+	return ctx->syntaxDictFile;
+}
+GS1_ENCODERS_API bool gs1_encoder_setSyntaxDictionary(gs1_encoder *ctx, const char *file) {
+	assert(ctx);
+	assert(file);
+	reset_error(ctx);
+	if (strlen(file) > MAX_FNAME) {
+		sprintf(ctx->errMsg, "Maximum syntax dictionary file is %d characters", MAX_FNAME);
+		ctx->errFlag = true;
+		return false;
+	}
+	if (*file == '\0')
+		gs1_freeSyntaxDict(ctx);
+	else if (!gs1_loadSyntaxDict(ctx, file))
+		return false;
+	strcpy(ctx->syntaxDictFile, file);
+	ctx->numAIs = 0;	// Extracted AIs refer to the previous table
+	return true;
+}
+
+
 GS1_ENCODERS_API int gs1_encoder_getFormat(gs1_encoder *ctx) {
 	assert(ctx);
 	reset_error(ctx);
@@ -583,6 +896,21 @@ GS1_ENCODERS_API bool gs1_encoder_setFormat(gs1_encoder *ctx, const int format)
 			case gs1_encoder_dRAW:
 				strcpy(ctx->outFile, "");
 				break;
+			case gs1_encoder_dSVG:
+				strcpy(ctx->outFile, DEFAULT_SVG_FILE);
+				break;
+			case gs1_encoder_dEPS:
+				strcpy(ctx->outFile, DEFAULT_EPS_FILE);
+				break;
+			case gs1_encoder_dPDF:
+				strcpy(ctx->outFile, DEFAULT_PDF_FILE);
+				break;
+			case gs1_encoder_dZPL:
+				strcpy(ctx->outFile, DEFAULT_ZPL_FILE);
+				break;
+			case gs1_encoder_dESCPOS:
+				strcpy(ctx->outFile, DEFAULT_ESCPOS_FILE);
+				break;
 			default:     // No such format
 				return false;
 		}
@@ -629,6 +957,62 @@ GS1_ENCODERS_API bool gs1_encoder_setOutFile(gs1_encoder *ctx, const char* outFi
 }
 
 
+GS1_ENCODERS_API bool gs1_encoder_getStreamRows(gs1_encoder *ctx) {
+	assert(ctx);
+	reset_error(ctx);
+	return ctx->streamRows;
+}
+GS1_ENCODERS_API bool gs1_encoder_setStreamRows(gs1_encoder *ctx, const bool streamRows) {
+	assert(ctx);
+	reset_error(ctx);
+	ctx->streamRows = streamRows;
+	return true;
+}
+
+
+GS1_ENCODERS_API bool gs1_encoder_getRetainBuffer(gs1_encoder *ctx) {
+	assert(ctx);
+	reset_error(ctx);
+	return ctx->retainBuffer;
+}
+GS1_ENCODERS_API bool gs1_encoder_setRetainBuffer(gs1_encoder *ctx, const bool retainBuffer) {
+	assert(ctx);
+	reset_error(ctx);
+	ctx->retainBuffer = retainBuffer;
+	return true;
+}
+
+
+GS1_ENCODERS_API bool gs1_encoder_setOutputBuffer(gs1_encoder *ctx, void *buf, const size_t size) {
+	assert(ctx);
+	reset_error(ctx);
+	if (!buf ^ (size == 0)) {
+		strcpy(ctx->errMsg, "An output buffer must be given together with its size");
+		ctx->errFlag = true;
+		return false;
+	}
+	free_bufferStrings(ctx);
+	if (!ctx->userBuffer)
+		free(ctx->buffer);
+	ctx->buffer = buf;
+	ctx->bufferCap = size;
+	ctx->bufferSize = 0;
+	ctx->bufferWidth = 0;
+	ctx->bufferHeight = 0;
+	ctx->userBuffer = buf != NULL;
+	return true;
+}
+
+
+GS1_ENCODERS_API bool gs1_encoder_setRowCallback(gs1_encoder *ctx, const gs1_encoder_rowCallback callback, void *userData) {
+	assert(ctx);
+	reset_error(ctx);
+	ctx->rowCallback = callback;
+	ctx->rowCallbackData = userData;
+	return true;
+}
+
+
 GS1_ENCODERS_API char* gs1_encoder_getDataStr(gs1_encoder *ctx) {
 	assert(ctx);
 	reset_error(ctx);
@@ -655,6 +1039,8 @@ GS1_ENCODERS_API bool gs1_encoder_setDataStr(gs1_encoder *ctx, const char* dataS
 	if ((strlen(ctx->dataStr) >= 8 && strncmp(ctx->dataStr, "https://", 8) == 0) ||	// Digital Link URI
 	    (strlen(ctx->dataStr) >= 7 && strncmp(ctx->dataStr, "http://",  7) == 0)) {
 		// We extract AIs with the element string stored in dlAIbuffer
+		if ((ctx->dlAIbuffer = gs1_scratch(ctx, ctx->dlAIbuffer, MAX_DATA+1)) == NULL)
+			goto fail;
 		if (!gs1_parseDLuri(ctx, ctx->dataStr, ctx->dlAIbuffer))
 			goto fail;
 	}
@@ -663,8 +1049,7 @@ GS1_ENCODERS_API bool gs1_encoder_setDataStr(gs1_encoder *ctx, const char* dataS
 		if (*ctx->dataStr == '^' && !gs1_processAIdata(ctx, ctx->dataStr, true))
 			goto fail;
 		if (ctx->numAIs >= MAX_AIS) {
-			strcpy(ctx->errMsg, "Too many AIs");
-			ctx->errFlag = true;
+			gs1_setError(ctx, gs1_encoder_eTOO_MANY_AIS, NULL, 0, -1);
 			goto fail;
 		}
 		ctx->aiData[ctx->numAIs++].aiEntry = NULL;		// Indicate separator in HRI
@@ -677,6 +1062,9 @@ GS1_ENCODERS_API bool gs1_encoder_setDataStr(gs1_encoder *ctx, const char* dataS
 			goto fail;
 	}
 
+	if (ctx->validateAIassociations && !gs1_validateAIassociations(ctx))
+		goto fail;
+
 	return true;
 
 fail:
@@ -707,8 +1095,7 @@ GS1_ENCODERS_API bool gs1_encoder_setAIdataStr(gs1_encoder *ctx, const char* gs1
 			return false;
 		}
 		if (ctx->numAIs >= MAX_AIS) {
-			strcpy(ctx->errMsg, "Too many AIs");
-			ctx->errFlag = true;
+			gs1_setError(ctx, gs1_encoder_eTOO_MANY_AIS, NULL, 0, -1);
 			*ctx->dataStr = '\0';
 			ctx->numAIs = 0;
 			return false;
@@ -730,6 +1117,31 @@ GS1_ENCODERS_API bool gs1_encoder_setAIdataStr(gs1_encoder *ctx, const char* gs1
 		}
 	}
 
+	if (ctx->validateAIassociations && !gs1_validateAIassociations(ctx)) {
+		*ctx->dataStr = '\0';
+		ctx->numAIs = 0;
+		return false;
+	}
+
+	return true;
+
+}
+
+
+GS1_ENCODERS_API bool gs1_encoder_setAIs(gs1_encoder *ctx, const gs1_encoder_ai *ais, const size_t num) {
+
+	assert(ctx);
+	assert(ais || num == 0);
+	reset_error(ctx);
+
+	ctx->numAIs = 0;
+	if (!gs1_writeAIs(ctx, ais, num, ctx->dataStr) ||
+	    (ctx->validateAIassociations && !gs1_validateAIassociations(ctx))) {
+		*ctx->dataStr = '\0';
+		ctx->numAIs = 0;
+		return false;
+	}
+
 	return true;
 
 }
@@ -739,7 +1151,7 @@ GS1_ENCODERS_API char* gs1_encoder_getAIdataStr(gs1_encoder *ctx) {
 
 	int i, j;
 	struct aiValue ai;
-	char *p = ctx->outStr;
+	char *p;
 
 	assert(ctx);
 	assert(ctx->numAIs <= MAX_AIS);
@@ -748,6 +1160,9 @@ GS1_ENCODERS_API char* gs1_encoder_getAIdataStr(gs1_encoder *ctx) {
 	if (ctx->numAIs == 0)		// Not GS1 data
 		return NULL;
 
+	if ((p = ctx->outStr = gs1_scratch(ctx, ctx->outStr, 2*MAX_DATA+1)) == NULL)
+		return NULL;
+
 	for (i = 0; i < ctx->numAIs; i++) {
 		ai = ctx->aiData[i];
 		if (ai.aiEntry) {
@@ -785,12 +1200,17 @@ GS1_ENCODERS_API int gs1_encoder_getHRI(gs1_encoder *ctx, char*** out) {
 
 	int i, j;
 	struct aiValue ai;
-	char *p = ctx->outStr;
+	char *p;
 
 	assert(ctx);
 	assert(ctx->numAIs <= MAX_AIS);
 	reset_error(ctx);
 
+	if ((p = ctx->outStr = gs1_scratch(ctx, ctx->outStr, 2*MAX_DATA+1)) == NULL) {
+		*out = NULL;
+		return 0;
+	}
+
 	*p = '\0';
 	for (i = 0, j = 0; i < ctx->numAIs; i++) {
 		ai = ctx->aiData[i];
@@ -874,25 +1294,55 @@ GS1_ENCODERS_API bool gs1_encoder_setDataFile(gs1_encoder *ctx, const char* data
 
 GS1_ENCODERS_API char* gs1_encoder_getErrMsg(gs1_encoder *ctx) {
 	assert(ctx);
-	assert(!ctx->errFlag ^ *ctx->errMsg);
+	if (ctx->errFlag && *ctx->errMsg == '\0' && ctx->errCode != gs1_encoder_eNONE)
+		snprintf(ctx->errMsg, sizeof(ctx->errMsg), errFormats[ctx->errCode], ctx->errAI, ctx->errPairAI);
+	assert(!ctx->errFlag || *ctx->errMsg);
 	return ctx->errMsg;
 }
 
 
+GS1_ENCODERS_API int gs1_encoder_getErrCode(gs1_encoder *ctx) {
+	assert(ctx);
+	if (!ctx->errFlag)
+		return gs1_encoder_eNONE;
+	return ctx->errCode != gs1_encoder_eNONE ? ctx->errCode : gs1_encoder_eOTHER;
+}
+
+
+GS1_ENCODERS_API const char* gs1_encoder_getErrAI(gs1_encoder *ctx) {
+	assert(ctx);
+	return ctx->errFlag ? ctx->errAI : "";
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_getErrOffset(gs1_encoder *ctx) {
+	assert(ctx);
+	return ctx->errFlag ? ctx->errOffset : -1;
+}
+
+
 GS1_ENCODERS_API bool gs1_encoder_encode(gs1_encoder *ctx) {
 
 	FILE *iFile;
+	char *ccSep;
 
 	assert(ctx);
 	reset_error(ctx);
 
-	free_bufferStrings(ctx);
-	free(ctx->buffer);
-	ctx->buffer = NULL;
-	ctx->bufferCap = 0;
-	ctx->bufferSize = 0;
-	ctx->bufferWidth = 0;
-	ctx->bufferHeight = 0;
+	// Measuring leaves any existing output intact
+	if (!ctx->measureOnly) {
+		free_bufferStrings(ctx);
+		if (!ctx->retainBuffer && !ctx->userBuffer) {
+			free(ctx->buffer);
+			ctx->buffer = NULL;
+			ctx->bufferCap = 0;
+		}
+		ctx->bufferSize = 0;
+		ctx->bufferWidth = 0;
+		ctx->bufferHeight = 0;
+		gs1_driverFreeRows(ctx);
+	}
+	ctx->driver_outSize = 0;
 
 	if (ctx->pixMult == 0) {
 		strcpy(ctx->errMsg, "X-dimension must be set before encoding a symbol");
@@ -900,6 +1350,12 @@ GS1_ENCODERS_API bool gs1_encoder_encode(gs1_encoder *ctx) {
 		return false;
 	}
 
+	if (ctx->streamRows && ctx->format != gs1_encoder_dRAW) {
+		strcpy(ctx->errMsg, "Row streaming requires RAW format output");
+		ctx->errFlag = true;
+		return false;
+	}
+
 	if (ctx->fileInputFlag) {
 		size_t i;
 		if ((iFile = fopen(ctx->dataFile, "r")) == NULL) {
@@ -915,6 +1371,12 @@ GS1_ENCODERS_API bool gs1_encoder_encode(gs1_encoder *ctx) {
 			return false;
 	}
 
+	if (!alloc_symScratch(ctx))
+		return false;
+
+	// Encoders split any composite component from the primary data in place
+	ccSep = strchr(ctx->dataStr, '|');
+
 	switch (ctx->sym) {
 
 		case gs1_encoder_sDataBarOmni:
@@ -974,9 +1436,22 @@ GS1_ENCODERS_API bool gs1_encoder_encode(gs1_encoder *ctx) {
 
 	}
 
+	// The separator is not restored when output fails part way through
+	if (ccSep)
+		*ccSep = '|';
+
 	if (ctx->errFlag) {
-		assert(!ctx->buffer && ctx->bufferCap == 0 && ctx->bufferSize == 0 &&
-			ctx->bufferWidth == 0 && ctx->bufferHeight == 0);
+		if (!ctx->measureOnly) {
+			gs1_driverFreeRows(ctx);
+			if (!ctx->retainBuffer && !ctx->userBuffer) {
+				free(ctx->buffer);
+				ctx->buffer = NULL;
+				ctx->bufferCap = 0;
+			}
+			ctx->bufferSize = 0;
+			ctx->bufferWidth = 0;
+			ctx->bufferHeight = 0;
+		}
 		return false;
 	}
 
@@ -985,43 +1460,234 @@ GS1_ENCODERS_API bool gs1_encoder_encode(gs1_encoder *ctx) {
 }
 
 
-GS1_ENCODERS_API size_t gs1_encoder_getBuffer(gs1_encoder *ctx, void** out) {
+GS1_ENCODERS_API bool gs1_encoder_encodeModules(gs1_encoder *ctx) {
+
+	int pixMult, Xundercut, Yundercut, sepHt, format;
+	bool streamRows, ret;
+
 	assert(ctx);
 
-	if (!ctx->buffer) {
-		assert(ctx->bufferSize == 0);
-		*out = NULL;
-		return 0;
-	}
+	// Render a RAW image into the buffer at one pixel per module
+	pixMult = ctx->pixMult;
+	Xundercut = ctx->Xundercut;
+	Yundercut = ctx->Yundercut;
+	sepHt = ctx->sepHt;
+	format = ctx->format;
+	streamRows = ctx->streamRows;
+
+	ctx->pixMult = 1;
+	ctx->Xundercut = 0;
+	ctx->Yundercut = 0;
+	ctx->sepHt = 1;
+	ctx->format = gs1_encoder_dRAW;
+	ctx->streamRows = false;
+	ctx->moduleMode = true;
 
-	assert(ctx->bufferSize > 0);
+	ret = gs1_encoder_encode(ctx);
+
+	ctx->moduleMode = false;
+	ctx->pixMult = pixMult;
+	ctx->Xundercut = Xundercut;
+	ctx->Yundercut = Yundercut;
+	ctx->sepHt = sepHt;
+	ctx->format = format;
+	ctx->streamRows = streamRows;
+
+	return ret;
 
-	*out = ctx->buffer;
-	return ctx->bufferSize;
 }
 
 
-GS1_ENCODERS_API size_t gs1_encoder_getBufferSize(gs1_encoder *ctx) {
+GS1_ENCODERS_API size_t gs1_encoder_getOutputSize(gs1_encoder *ctx) {
+
+	bool ret;
+
 	assert(ctx);
 
-	if (!ctx->buffer) {
-		assert(ctx->bufferSize == 0);
-		return 0;
-	}
+	ctx->measureOnly = true;
+	ret = gs1_encoder_encode(ctx);
+	ctx->measureOnly = false;
+
+	return ret ? ctx->driver_outSize : 0;
 
-	return ctx->bufferSize;
 }
 
 
-GS1_ENCODERS_API size_t gs1_encoder_copyOutputBuffer(gs1_encoder *ctx, void *buf, size_t max) {
+GS1_ENCODERS_API size_t gs1_encoder_encodeBatch(gs1_encoder *ctx, const char* const *dataStrs, const size_t num,
+						 void *arena, const size_t max, size_t *offsets, size_t *sizes) {
+
+	size_t i, used = 0;
+	bool retain;
+
 	assert(ctx);
+	assert(dataStrs || num == 0);
+	assert(arena || max == 0);
+	assert(offsets || num == 0);
+	assert(sizes || num == 0);
+	reset_error(ctx);
 
-	if (!ctx->buffer) {
-		assert(ctx->bufferSize == 0);
+	if (strcmp(ctx->outFile, "") != 0 || ctx->streamRows) {
+		strcpy(ctx->errMsg, "Batch encoding requires output to a buffer");
+		ctx->errFlag = true;
 		return 0;
 	}
 
-	if (max < ctx->bufferSize) {
+	if (ctx->fileInputFlag) {
+		strcpy(ctx->errMsg, "Batch encoding does not support file input");
+		ctx->errFlag = true;
+		return 0;
+	}
+
+	/*
+	 * The output buffer allocation is carried from one symbol to the next
+	 * so that its capacity settles after the first few messages, after
+	 * which each symbol is rendered without any further heap traffic.
+	 *
+	 */
+	retain = ctx->retainBuffer;
+	ctx->retainBuffer = true;
+
+	for (i = 0; i < num; i++) {
+		assert(dataStrs[i]);
+		if (!gs1_encoder_setDataStr(ctx, dataStrs[i]) || !gs1_encoder_encode(ctx))
+			break;
+		if (ctx->bufferSize > max - used) {
+			sprintf(ctx->errMsg, "Batch output arena is full at message %d", (int)i);
+			ctx->errFlag = true;
+			break;
+		}
+		memcpy((uint8_t*)arena + used, ctx->buffer, ctx->bufferSize);
+		offsets[i] = used;
+		sizes[i] = ctx->bufferSize;
+		used += ctx->bufferSize;
+	}
+
+	ctx->retainBuffer = retain;
+
+	// Leave the buffer as a regular encode would
+	if (ctx->errFlag) {
+		if (!ctx->retainBuffer && !ctx->userBuffer) {
+			free(ctx->buffer);
+			ctx->buffer = NULL;
+			ctx->bufferCap = 0;
+		}
+		ctx->bufferSize = 0;
+		ctx->bufferWidth = 0;
+		ctx->bufferHeight = 0;
+	}
+
+	return i;
+
+}
+
+
+static bool checkKeyLayout(gs1_encoder *ctx, const size_t keyLen, const size_t stride) {
+
+	if (keyLen < 2) {
+		strcpy(ctx->errMsg, "Keys must have at least two digits");
+		ctx->errFlag = true;
+		return false;
+	}
+
+	if (stride < keyLen) {
+		strcpy(ctx->errMsg, "Key stride must be at least the key length");
+		ctx->errFlag = true;
+		return false;
+	}
+
+	return true;
+
+}
+
+
+GS1_ENCODERS_API size_t gs1_encoder_validateCheckDigits(gs1_encoder *ctx, const char *keys, const size_t keyLen, const size_t stride,
+							const size_t num, bool *valid) {
+
+	size_t i, count = 0;
+	int cd;
+	const uint8_t *key = (const uint8_t*)keys;
+
+	assert(ctx);
+	assert(keys || num == 0);
+	assert(valid || num == 0);
+	reset_error(ctx);
+
+	if (!checkKeyLayout(ctx, keyLen, stride))
+		return 0;
+
+	for (i = 0; i < num; i++, key += stride) {
+		valid[i] = (cd = gs1_checkDigit(key, keyLen - 1)) >= 0 && cd + '0' == key[keyLen - 1];
+		if (valid[i])
+			count++;
+	}
+
+	return count;
+
+}
+
+
+GS1_ENCODERS_API size_t gs1_encoder_computeCheckDigits(gs1_encoder *ctx, char *keys, const size_t keyLen, const size_t stride, const size_t num) {
+
+	size_t i;
+	int cd;
+	char *key = keys;
+
+	assert(ctx);
+	assert(keys || num == 0);
+	reset_error(ctx);
+
+	if (!checkKeyLayout(ctx, keyLen, stride))
+		return 0;
+
+	for (i = 0; i < num; i++, key += stride) {
+		if ((cd = gs1_checkDigit((uint8_t*)key, keyLen - 1)) < 0) {
+			sprintf(ctx->errMsg, "Key %d contains a non-digit character", (int)i);
+			ctx->errFlag = true;
+			break;
+		}
+		key[keyLen - 1] = (char)(cd + '0');
+	}
+
+	return i;
+
+}
+
+
+GS1_ENCODERS_API size_t gs1_encoder_getBuffer(gs1_encoder *ctx, void** out) {
+	assert(ctx);
+
+	// A retained or user-provided buffer may exist without holding an image
+	if (!ctx->buffer || ctx->bufferSize == 0) {
+		*out = NULL;
+		return 0;
+	}
+
+	*out = ctx->buffer;
+	return ctx->bufferSize;
+}
+
+
+GS1_ENCODERS_API size_t gs1_encoder_getBufferSize(gs1_encoder *ctx) {
+	assert(ctx);
+
+	if (!ctx->buffer) {
+		assert(ctx->bufferSize == 0);
+		return 0;
+	}
+
+	return ctx->bufferSize;
+}
+
+
+GS1_ENCODERS_API size_t gs1_encoder_copyOutputBuffer(gs1_encoder *ctx, void *buf, size_t max) {
+	assert(ctx);
+
+	if (!ctx->buffer) {
+		assert(ctx->bufferSize == 0);
+		return 0;
+	}
+
+	if (max < ctx->bufferSize) {
 		return 0;
 	}
 
@@ -1039,7 +1705,7 @@ GS1_ENCODERS_API size_t gs1_encoder_getBufferStrings(gs1_encoder *ctx, char*** o
 
 	assert(ctx);
 
-	if (!ctx->buffer) {
+	if (!ctx->buffer || ctx->bufferSize == 0) {
 		*out = NULL;
 		return 0;
 	}
@@ -1078,24 +1744,46 @@ out:
 
 GS1_ENCODERS_API int gs1_encoder_getBufferWidth(gs1_encoder *ctx) {
 	assert(ctx);
-	assert(!ctx->buffer ^ (ctx->bufferWidth > 0));
+	assert(ctx->streamRows || !ctx->bufferSize ^ (ctx->bufferWidth > 0));
 	return ctx->bufferWidth;
 }
 
 
 GS1_ENCODERS_API int gs1_encoder_getBufferHeight(gs1_encoder *ctx) {
 	assert(ctx);
-	assert(!ctx->buffer ^ (ctx->bufferHeight > 0));
+	assert(ctx->streamRows || !ctx->bufferSize ^ (ctx->bufferHeight > 0));
 	return ctx->bufferHeight;
 }
 
 
+GS1_ENCODERS_API size_t gs1_encoder_nextRow(gs1_encoder *ctx, const void **row) {
+
+	const uint8_t *line;
+	size_t len;
+
+	assert(ctx);
+	assert(row);
+	reset_error(ctx);
+
+	len = gs1_driverNextRow(ctx, &line);
+	*row = line;
+	return len;
+
+}
+
+
 
 #ifdef UNIT_TESTS
 
 #define TEST_NO_MAIN
 #include "acutest.h"
 
+#ifdef ACUTEST_UNIX_
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#endif
+
 // Used to test compile-time buffer allocation for the gs1encoder instance
 static uint8_t static_buf[sizeof(gs1_encoder)];
 
@@ -1767,6 +2455,38 @@ void test_api_qrEClevel(void) {
 }
 
 
+void test_api_qrMaskStrategy(void) {
+
+	gs1_encoder* ctx;
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+
+	TEST_CHECK(gs1_encoder_getQrMaskStrategy(ctx) == gs1_encoder_qrMaskEvaluate);  // Default
+	TEST_CHECK(gs1_encoder_getQrMask(ctx) == 0);
+
+	TEST_CHECK(gs1_encoder_setQrMaskStrategy(ctx, gs1_encoder_qrMaskFast));
+	TEST_CHECK(gs1_encoder_getQrMaskStrategy(ctx) == gs1_encoder_qrMaskFast);
+
+	TEST_CHECK(gs1_encoder_setQrMaskStrategy(ctx, gs1_encoder_qrMaskFixed));
+	TEST_CHECK(gs1_encoder_getQrMaskStrategy(ctx) == gs1_encoder_qrMaskFixed);
+
+	TEST_CHECK(gs1_encoder_setQrMaskStrategy(ctx, gs1_encoder_qrMaskEvaluate));
+	TEST_CHECK(gs1_encoder_getQrMaskStrategy(ctx) == gs1_encoder_qrMaskEvaluate);
+
+	TEST_CHECK(!gs1_encoder_setQrMaskStrategy(ctx, gs1_encoder_qrMaskEvaluate - 1));
+	TEST_CHECK(!gs1_encoder_setQrMaskStrategy(ctx, gs1_encoder_qrMaskFixed + 1));
+
+	TEST_CHECK(gs1_encoder_setQrMask(ctx, 7));
+	TEST_CHECK(gs1_encoder_getQrMask(ctx) == 7);
+	TEST_CHECK(!gs1_encoder_setQrMask(ctx, -1));
+	TEST_CHECK(!gs1_encoder_setQrMask(ctx, 8));
+	TEST_CHECK(gs1_encoder_getQrMask(ctx) == 7);
+
+	gs1_encoder_free(ctx);
+
+}
+
+
 void test_api_addCheckDigit(void) {
 
 	gs1_encoder* ctx;
@@ -2232,4 +2952,906 @@ void test_api_copyOutputBuffer(void) {
 }
 
 
+void test_api_encodeBatch(void) {
+
+	gs1_encoder* ctx;
+	uint8_t arena[8192];
+	size_t offsets[3], sizes[3];
+	uint8_t *buf;
+	size_t size;
+	int i;
+	const char *dataStrs[] = {
+		"^0112345678901231",
+		"^011231231231233310ABC123",
+		"^00006141411234567890",
+	};
+	const char *badDataStrs[] = {
+		"^0112345678901231",
+		"^0112345678901234",		// Bad check digit
+		"^00006141411234567890",
+	};
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+
+	TEST_CHECK(gs1_encoder_setSym(ctx, gs1_encoder_sDM));
+	TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dRAW));
+
+	// Batch requires buffer output
+	TEST_CHECK(gs1_encoder_setOutFile(ctx, "test.file"));
+	TEST_CHECK(gs1_encoder_encodeBatch(ctx, dataStrs, 3, arena, sizeof(arena), offsets, sizes) == 0);
+	TEST_CHECK(*gs1_encoder_getErrMsg(ctx) != '\0');
+	TEST_CHECK(gs1_encoder_setOutFile(ctx, ""));
+
+	// Each symbol is placed in the arena just as a single encode would render it
+	TEST_ASSERT(gs1_encoder_encodeBatch(ctx, dataStrs, 3, arena, sizeof(arena), offsets, sizes) == 3);
+	TEST_CHECK(offsets[0] == 0);
+	for (i = 0; i < 3; i++) {
+		TEST_CASE(dataStrs[i]);
+		if (i > 0)
+			TEST_CHECK(offsets[i] == offsets[i-1] + sizes[i-1]);
+		TEST_CHECK(gs1_encoder_setDataStr(ctx, dataStrs[i]));
+		TEST_CHECK(gs1_encoder_encode(ctx));
+		TEST_CHECK((size = gs1_encoder_getBuffer(ctx, (void*)&buf)) == sizes[i]);
+		TEST_CHECK(memcmp(arena + offsets[i], buf, size) == 0);
+	}
+
+	// Stops at the first failure, reporting the number completed
+	TEST_CHECK(gs1_encoder_encodeBatch(ctx, badDataStrs, 3, arena, sizeof(arena), offsets, sizes) == 1);
+	TEST_CHECK(*gs1_encoder_getErrMsg(ctx) != '\0');
+	TEST_CHECK(gs1_encoder_getBuffer(ctx, (void*)&buf) == 0);
+
+	// Arena exhaustion
+	TEST_CHECK(gs1_encoder_encodeBatch(ctx, dataStrs, 3, arena, sizes[0] + 1, offsets, sizes) == 1);
+	TEST_CHECK(*gs1_encoder_getErrMsg(ctx) != '\0');
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+void test_api_scratch(void) {
+
+#ifndef NOMALLOC
+
+	gs1_encoder* ctx;
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+	TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dRAW));
+	TEST_CHECK(gs1_encoder_setOutFile(ctx, ""));
+
+	// A plain linear symbol needs nothing more than a short print line
+	TEST_CHECK(gs1_encoder_setSym(ctx, gs1_encoder_sEAN13));
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "2112345678900"));
+	TEST_ASSERT(gs1_encoder_encode(ctx));
+	TEST_CHECK(ctx->driver_line && ctx->driver_lineCap < MAX_LINE/8 + 1);
+	TEST_CHECK(!ctx->ccPattern && !ctx->cc_gpa && !ctx->ucc128_patCCC && !ctx->qr_pats && !ctx->qr_layout && !ctx->rs_code);
+	TEST_CHECK(!ctx->dlAIbuffer && !ctx->outStr);
+
+	// Composite component
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "2112345678900|^99123456"));
+	TEST_ASSERT(gs1_encoder_encode(ctx));
+	TEST_CHECK(ctx->ccPattern && ctx->cc_gpa && !ctx->qr_pats);
+
+	// Matrix symbologies share the pattern rows, grown as required
+	TEST_CHECK(gs1_encoder_setSym(ctx, gs1_encoder_sDM));
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "https://id.gs1.org/01/12312312312333"));
+	TEST_ASSERT(gs1_encoder_encode(ctx));
+	TEST_CHECK(ctx->dm_pats && ctx->patsCap == MAX_DM_ROWS && ctx->dlAIbuffer);
+	TEST_CHECK(ctx->rs_code && ctx->rs_code->field == gs1_rsFieldDM);
+	TEST_CHECK(gs1_encoder_setSym(ctx, gs1_encoder_sQR));
+	TEST_ASSERT(gs1_encoder_encode(ctx));
+	TEST_CHECK(ctx->qr_pats && ctx->patsCap == MAX_QR_SIZE && ctx->qr_layout);
+	TEST_CHECK(ctx->rs_code && ctx->rs_code->field == gs1_rsFieldQR);
+
+	TEST_CHECK(gs1_encoder_getScanData(ctx) != NULL);
+	TEST_CHECK(ctx->outStr != NULL);
+
+	gs1_encoder_free(ctx);
+
+#endif
+
+}
+
+
+// Symbols that exercise each renderer: linear and stacked with composite
+// components, GS1-128 with CC-C, and the matrix symbologies
+static const struct {
+	int sym;
+	const char *dataStr;
+} test_symbols[] = {
+	{ gs1_encoder_sEAN13, "2112345678900|^99123456" },
+	{ gs1_encoder_sDataBarExpanded, "^0100012345678905^10ABC123^11210101|^99123456" },
+	{ gs1_encoder_sDataBarStackedOmni, "^0100012345678905|^10ABC123" },
+	{ gs1_encoder_sGS1_128_CCC, "^011231231231233310ABC123|^99XYZ1234567890" },
+	{ gs1_encoder_sQR, "https://id.gs1.org/01/12312312312333" },
+	{ gs1_encoder_sDM, "^0112312312312333^10ABC123" },
+};
+
+static void test_setSymbol(gs1_encoder *ctx, const int i) {
+	TEST_CASE(test_symbols[i].dataStr);
+	TEST_CHECK(gs1_encoder_setSym(ctx, test_symbols[i].sym));
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, test_symbols[i].dataStr));
+}
+
+// Encode a symbol as a RAW image, the reference for the other output methods
+static size_t test_rawReference(gs1_encoder *ctx, const int i, uint8_t *expect, const size_t max, int *width, int *height) {
+
+	size_t size;
+
+	test_setSymbol(ctx, i);
+	TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dRAW));
+	TEST_ASSERT(gs1_encoder_encode(ctx));
+	TEST_ASSERT((size = gs1_encoder_copyOutputBuffer(ctx, expect, max)) > 0);
+	*width = gs1_encoder_getBufferWidth(ctx);
+	*height = gs1_encoder_getBufferHeight(ctx);
+
+	return size;
+
+}
+
+
+struct test_rows {
+	uint8_t buf[65536];
+	size_t size;
+	int rows;
+};
+
+static void test_rowCallback(void *userData, const void *row, const size_t length) {
+	struct test_rows *rows = (struct test_rows *)userData;
+	TEST_ASSERT(rows->size + length <= sizeof(rows->buf));
+	memcpy(rows->buf + rows->size, row, length);
+	rows->size += length;
+	rows->rows++;
+}
+
+void test_api_streamRows(void) {
+
+	gs1_encoder* ctx;
+	static struct test_rows rows;
+	uint8_t expect[65536];
+	const void *row;
+	size_t size, len;
+	int i, width, height;
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+	TEST_CHECK(gs1_encoder_getStreamRows(ctx) == false);
+
+	// Only the RAW format is streamed
+	TEST_CHECK(gs1_encoder_setSym(ctx, gs1_encoder_sEAN13));
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "2112345678900"));
+	TEST_CHECK(gs1_encoder_setStreamRows(ctx, true));
+	TEST_CHECK(gs1_encoder_getStreamRows(ctx) == true);
+	TEST_CHECK(!gs1_encoder_encode(ctx));
+	TEST_CHECK(*gs1_encoder_getErrMsg(ctx) != '\0');
+
+	TEST_CHECK(gs1_encoder_setPixMult(ctx, 3));
+	TEST_CHECK(gs1_encoder_setYundercut(ctx, 1));
+	TEST_CHECK(gs1_encoder_setXundercut(ctx, 1));
+
+	for (i = 0; i < (int)SIZEOF_ARRAY(test_symbols); i++) {
+
+		// Reference image rendered to the buffer
+		TEST_CHECK(gs1_encoder_setStreamRows(ctx, false));
+		size = test_rawReference(ctx, i, expect, sizeof(expect), &width, &height);
+
+		// Pushed to a callback during encoding
+		TEST_CHECK(gs1_encoder_setStreamRows(ctx, true));
+		TEST_CHECK(gs1_encoder_setRowCallback(ctx, test_rowCallback, &rows));
+		rows.size = 0;
+		rows.rows = 0;
+		TEST_ASSERT(gs1_encoder_encode(ctx));
+		TEST_CHECK(gs1_encoder_getBufferSize(ctx) == 0);
+		TEST_CHECK(gs1_encoder_getBufferWidth(ctx) == width);
+		TEST_CHECK(gs1_encoder_getBufferHeight(ctx) == height);
+		TEST_CHECK(rows.rows == height);
+		TEST_CHECK(rows.size == size && memcmp(rows.buf, expect, size) == 0);
+		TEST_CHECK(gs1_encoder_nextRow(ctx, &row) == 0);
+
+		// Pulled after encoding
+		TEST_CHECK(gs1_encoder_setRowCallback(ctx, NULL, NULL));
+		rows.size = 0;
+		rows.rows = 0;
+		TEST_ASSERT(gs1_encoder_encode(ctx));
+		TEST_CHECK(gs1_encoder_getBufferSize(ctx) == 0);
+		while ((len = gs1_encoder_nextRow(ctx, &row)) > 0)
+			test_rowCallback(&rows, row, len);
+		TEST_CHECK(row == NULL);
+		TEST_CHECK(rows.rows == height);
+		TEST_CHECK(rows.size == size && memcmp(rows.buf, expect, size) == 0);
+		TEST_CHECK(gs1_encoder_nextRow(ctx, &row) == 0);
+
+	}
+
+	// Rows that are not pulled are released on the next encode and on free
+	TEST_ASSERT(gs1_encoder_encode(ctx));
+	TEST_CHECK(gs1_encoder_nextRow(ctx, &row) > 0);
+	TEST_ASSERT(gs1_encoder_encode(ctx));
+	TEST_CHECK(gs1_encoder_nextRow(ctx, &row) > 0);
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+void test_api_encodeModules(void) {
+
+	gs1_encoder* ctx;
+	uint8_t expect[8192];
+	uint8_t *buf;
+	size_t size;
+	int i, width, height;
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+
+	for (i = 0; i < (int)SIZEOF_ARRAY(test_symbols); i++) {
+
+		// Reference is a plain RAW image at one pixel per module
+		TEST_CHECK(gs1_encoder_setPixMult(ctx, 1));
+		size = test_rawReference(ctx, i, expect, sizeof(expect), &width, &height);
+
+		// Unaffected by the image configuration, which is left intact
+		TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dBMP));
+		TEST_CHECK(gs1_encoder_setOutFile(ctx, "test.file"));
+		TEST_CHECK(gs1_encoder_setPixMult(ctx, 4));
+		TEST_CHECK(gs1_encoder_setXundercut(ctx, 1));
+		TEST_CHECK(gs1_encoder_setYundercut(ctx, 1));
+		TEST_CHECK(gs1_encoder_setSepHt(ctx, 6));
+		TEST_ASSERT(gs1_encoder_encodeModules(ctx));
+		TEST_MSG("Error: %s", gs1_encoder_getErrMsg(ctx));
+		TEST_CHECK(gs1_encoder_getBufferWidth(ctx) == width);
+		TEST_CHECK(gs1_encoder_getBufferHeight(ctx) == height);
+		TEST_CHECK((size_t)((width-1)/8+1) * (size_t)height == size);
+		TEST_CHECK(gs1_encoder_getBuffer(ctx, (void*)&buf) == size);
+		TEST_CHECK(memcmp(buf, expect, size) == 0);
+		TEST_CHECK(gs1_encoder_getFormat(ctx) == gs1_encoder_dBMP);
+		TEST_CHECK(strcmp(gs1_encoder_getOutFile(ctx), "test.file") == 0);
+		TEST_CHECK(gs1_encoder_getPixMult(ctx) == 4);
+		TEST_CHECK(gs1_encoder_getXundercut(ctx) == 1);
+		TEST_CHECK(gs1_encoder_getYundercut(ctx) == 1);
+		TEST_CHECK(gs1_encoder_getSepHt(ctx) == 6);
+		TEST_CHECK(gs1_encoder_setOutFile(ctx, ""));
+		TEST_CHECK(gs1_encoder_setXundercut(ctx, 0));
+		TEST_CHECK(gs1_encoder_setYundercut(ctx, 0));
+
+	}
+
+	// Matrix symbologies do not need pattern rows
+	gs1_encoder_free(ctx);
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+	TEST_CHECK(gs1_encoder_setSym(ctx, gs1_encoder_sQR));
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "https://id.gs1.org/01/12312312312333"));
+	TEST_ASSERT(gs1_encoder_encodeModules(ctx));
+#ifndef NOMALLOC
+	TEST_CHECK(ctx->qr_pats == NULL);
+#endif
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+void test_api_vectorFormats(void) {
+
+	gs1_encoder* ctx;
+	static uint8_t expect[65536], image[65536];
+	char obj[16];
+	char *buf, *p, *q;
+	size_t size;
+	int i, j, x, y, w, h, bw, n, runs, width, height;
+	unsigned long off;
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+	TEST_CHECK(gs1_encoder_setPixMult(ctx, 3));
+	TEST_CHECK(gs1_encoder_setXundercut(ctx, 1));
+	TEST_CHECK(gs1_encoder_setYundercut(ctx, 1));
+
+	for (i = 0; i < (int)SIZEOF_ARRAY(test_symbols); i++) {
+
+		test_rawReference(ctx, i, expect, sizeof(expect), &width, &height);
+		bw = (width-1)/8+1;
+
+		// Painting the SVG rectangles reproduces the raster image
+		TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dSVG));
+		TEST_ASSERT(gs1_encoder_encode(ctx));
+		TEST_CHECK(gs1_encoder_getBufferWidth(ctx) == width);
+		TEST_CHECK(gs1_encoder_getBufferHeight(ctx) == height);
+		size = gs1_encoder_getBuffer(ctx, (void*)&buf);
+		TEST_ASSERT(size > 0 && buf[size-1] == '\n');
+		buf[size-1] = '\0';
+		TEST_CHECK(strstr(buf, "</svg>") != NULL);
+		TEST_ASSERT((p = strstr(buf, " d=\"")) != NULL);
+		memset(image, 0, sizeof(image));
+		n = 0;
+		while ((p = strchr(p, 'M')) != NULL) {
+			TEST_ASSERT(sscanf(p, "M%d %dh%dv%d", &x, &y, &w, &h) == 4);
+			TEST_ASSERT(x >= 0 && y >= 0 && w > 0 && h > 0 && x + w <= width && y + h <= height);
+			for (j = 0; j < w * h; j++)
+				image[bw*(y + j/w) + (x + j%w)/8] |= (uint8_t)(0x80 >> (x + j%w)%8);
+			p++;
+			n++;
+		}
+		TEST_CHECK(memcmp(image, expect, (size_t)(bw*height)) == 0);
+
+		// Runs that continue down the symbol are drawn once
+		for (j = 0, runs = 0; j < width * height; j++) {
+			x = j%width;
+			if ((expect[bw*(j/width) + x/8] >> (7-x%8) & 1) &&
+			    (x == 0 || !(expect[bw*(j/width) + (x-1)/8] >> (7-(x-1)%8) & 1)))
+				runs++;
+		}
+		TEST_CHECK(n > 0 && n * 2 < runs);
+		TEST_MSG("Rectangles %d; runs %d", n, runs);
+
+		TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dEPS));
+		TEST_ASSERT(gs1_encoder_encode(ctx));
+		size = gs1_encoder_getBuffer(ctx, (void*)&buf);
+		TEST_ASSERT(size > 0);
+		buf[size-1] = '\0';
+		TEST_CHECK(strncmp(buf, "%!PS-Adobe-3.0 EPSF-3.0\n", 24) == 0);
+		TEST_CHECK(strstr(buf, "%%EOF") != NULL);
+
+		// PDF cross-reference table and stream length are consistent
+		TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dPDF));
+		TEST_ASSERT(gs1_encoder_encode(ctx));
+		size = gs1_encoder_getBuffer(ctx, (void*)&buf);
+		TEST_ASSERT(size > 0);
+		buf[size-1] = '\0';
+		TEST_CHECK(strncmp(buf, "%PDF-1.4\n", 9) == 0);
+		TEST_ASSERT((p = strstr(buf, "startxref\n")) != NULL);
+		TEST_ASSERT(sscanf(p + 10, "%lu", &off) == 1 && off < size);
+		TEST_ASSERT(strncmp(buf + off, "xref\n0 6\n", 9) == 0);
+		q = buf + off + 9 + 20;
+		for (j = 1; j <= 5; j++, q += 20) {
+			TEST_ASSERT(sscanf(q, "%lu", &off) == 1 && off < size);
+			sprintf(obj, "%d 0 obj\n", j);
+			TEST_CHECK(strncmp(buf + off, obj, strlen(obj)) == 0);
+		}
+		TEST_ASSERT((p = strstr(buf, "stream\n")) != NULL);
+		TEST_ASSERT((q = strstr(buf, "\nendstream\n")) != NULL);
+		TEST_ASSERT(sscanf(strstr(q, "5 0 obj\n") + 8, "%lu", &off) == 1);
+		TEST_CHECK(off == (unsigned long)(q - p - 7));
+
+	}
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+void test_api_printerFormats(void) {
+
+	gs1_encoder* ctx;
+	static uint8_t expect[65536], image[65536];
+	uint8_t *buf;
+	char *p;
+	size_t size, pos;
+	int i, j, k, c, run, bw, total, width, height, lines;
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+	TEST_CHECK(gs1_encoder_setPixMult(ctx, 4));
+	TEST_CHECK(gs1_encoder_setYundercut(ctx, 1));
+
+	for (i = 0; i < (int)SIZEOF_ARRAY(test_symbols); i++) {
+
+		test_rawReference(ctx, i, expect, sizeof(expect), &width, &height);
+		bw = (width-1)/8+1;
+
+		// Expand the compressed ZPL hex, one line at a time
+		TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dZPL));
+		TEST_ASSERT(gs1_encoder_encode(ctx));
+		size = gs1_encoder_getBuffer(ctx, (void*)&buf);
+		TEST_ASSERT(size > 0 && size < (size_t)(bw*height));
+		p = (char*)buf;
+		TEST_ASSERT(sscanf(p, "^GFA,%d,%*d,%d,", &total, &k) == 2);
+		TEST_CHECK(total == bw*height && k == bw);
+		for (j = 0; j < 4; j++)
+			p = strchr(p, ',') + 1;
+		memset(image, 0, sizeof(image));
+		for (j = 0; j < height; j++) {
+			if (*p == ':') {
+				TEST_ASSERT(j > 0);
+				memcpy(&image[bw*j], &image[bw*(j-1)], (size_t)bw);
+				p++;
+				continue;
+			}
+			for (k = 0; k < bw*2; ) {
+				run = 0;
+				if (*p == ',' || *p == '!') {
+					c = *p++ == ',' ? 0 : 0xF;
+					run = bw*2 - k;
+				} else {
+					while (*p >= 'g' && *p <= 'z')
+						run += (*p++ - 'f') * 20;
+					if (*p >= 'G' && *p <= 'Y')
+						run += *p++ - 'F';
+					if (run == 0)
+						run = 1;
+					TEST_ASSERT(*p && strchr("0123456789ABCDEF", *p) != NULL);
+					c = *p >= 'A' ? *p - 'A' + 10 : *p - '0';
+					p++;
+				}
+				TEST_ASSERT(k + run <= bw*2);
+				for ( ; run > 0; run--, k++)
+					image[bw*j + k/2] |= (uint8_t)(c << (k & 1 ? 0 : 4));
+			}
+		}
+		TEST_CHECK(p == (char*)buf + size - 4 && memcmp(p, "^FS\n", 4) == 0);
+		TEST_CHECK(memcmp(image, expect, (size_t)(bw*height)) == 0);
+
+		// Collect the ESC/POS raster bands
+		TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dESCPOS));
+		TEST_ASSERT(gs1_encoder_encode(ctx));
+		size = gs1_encoder_getBuffer(ctx, (void*)&buf);
+		memset(image, 0, sizeof(image));
+		for (pos = 0, j = 0; pos < size; ) {
+			TEST_ASSERT(pos + 8 <= size);
+			TEST_ASSERT(memcmp(&buf[pos], "\x1Dv0\x00", 4) == 0);
+			TEST_CHECK(buf[pos+4] + buf[pos+5] * 256 == bw);
+			lines = buf[pos+6] + buf[pos+7] * 256;
+			TEST_ASSERT(lines > 0 && lines <= 256 && j + lines <= height);
+			pos += 8;
+			TEST_ASSERT(pos + (size_t)(bw*lines) <= size);
+			memcpy(&image[bw*j], &buf[pos], (size_t)(bw*lines));
+			pos += (size_t)(bw*lines);
+			j += lines;
+		}
+		TEST_CHECK(j == height);
+		TEST_CHECK(memcmp(image, expect, (size_t)(bw*height)) == 0);
+
+	}
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+#ifdef ACUTEST_UNIX_
+
+static const char *test_fifo = "gs1encoders-test.fifo";
+
+// Collect everything written to the FIFO until the writer closes it
+static void* test_fifoReader(void *userData) {
+
+	struct test_rows *rows = (struct test_rows *)userData;
+	ssize_t len;
+	int fd;
+
+	if ((fd = open(test_fifo, O_RDONLY)) < 0)
+		return NULL;
+	while ((len = read(fd, rows->buf + rows->size, sizeof(rows->buf) - rows->size)) > 0)
+		rows->size += (size_t)len;
+	close(fd);
+
+	return NULL;
+
+}
+
+#endif
+
+void test_api_bmpFormat(void) {
+
+	gs1_encoder* ctx;
+	static uint8_t expect[65536], image[65536];
+	uint8_t *buf;
+	FILE *fp;
+	size_t size;
+	int i, x, y, bw, pw, width, height;
+	static const char *fname = "gs1encoders-test.bmp";
+#ifdef ACUTEST_UNIX_
+	static struct test_rows piped;
+	pthread_t reader;
+	int fd;
+#endif
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+	TEST_CHECK(gs1_encoder_setPixMult(ctx, 3));
+	TEST_CHECK(gs1_encoder_setXundercut(ctx, 1));
+	TEST_CHECK(gs1_encoder_setYundercut(ctx, 1));
+
+	for (i = 0; i < (int)SIZEOF_ARRAY(test_symbols); i++) {
+
+		test_rawReference(ctx, i, expect, sizeof(expect), &width, &height);
+		bw = (width-1)/8+1;
+		pw = (width+31)/32*4;
+
+		// Same image as RAW, stored bottom-up with inverted bits and padded lines
+		TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dBMP));
+		TEST_ASSERT(gs1_encoder_encode(ctx));
+		size = gs1_encoder_getBuffer(ctx, (void*)&buf);
+		TEST_ASSERT(size == (size_t)(0x3E + pw * height));
+		TEST_CHECK(buf[0] == 'B' && buf[1] == 'M');
+		for (y = 0; y < height; y++) {
+			for (x = 0; x < bw; x++)
+				image[bw*y + x] = (uint8_t)~buf[0x3E + pw*(height-1-y) + x];
+			if (width % 8 != 0)
+				image[bw*y + bw-1] &= (uint8_t)(0xFF << (8 - width % 8));
+		}
+		TEST_CHECK(memcmp(image, expect, (size_t)(bw*height)) == 0);
+
+		// Lines are placed into the file in the same way
+		memcpy(expect, buf, size);
+		TEST_CHECK(gs1_encoder_setOutFile(ctx, fname));
+		TEST_ASSERT(gs1_encoder_encode(ctx));
+		TEST_CHECK(gs1_encoder_setOutFile(ctx, ""));
+		TEST_ASSERT((fp = fopen(fname, "rb")) != NULL);
+		TEST_CHECK(fread(image, 1, sizeof(image), fp) == size);
+		fclose(fp);
+		remove(fname);
+		TEST_CHECK(memcmp(image, expect, size) == 0);
+
+#ifdef ACUTEST_UNIX_
+		// Output that cannot seek, such as a pipe, is written in order
+		remove(test_fifo);
+		TEST_ASSERT(mkfifo(test_fifo, 0600) == 0);
+		piped.size = 0;
+		TEST_ASSERT(pthread_create(&reader, NULL, test_fifoReader, &piped) == 0);
+		TEST_CHECK(gs1_encoder_setOutFile(ctx, test_fifo));
+		TEST_CHECK(gs1_encoder_encode(ctx));
+		TEST_MSG("Error: %s", gs1_encoder_getErrMsg(ctx));
+		TEST_CHECK(gs1_encoder_setOutFile(ctx, ""));
+		if ((fd = open(test_fifo, O_WRONLY | O_NONBLOCK)) >= 0)
+			close(fd);	// Release a reader that is still waiting
+		pthread_join(reader, NULL);
+		remove(test_fifo);
+		TEST_CHECK(piped.size == size && memcmp(piped.buf, expect, size) == 0);
+		TEST_MSG("Got %zu bytes; Expected %zu", piped.size, size);
+#endif
+
+	}
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+void test_api_checkDigits(void) {
+
+	gs1_encoder* ctx;
+	static char keys[64 * 41];
+	char key[42];
+	bool valid[64];
+	size_t keyLen, stride, i, j, n;
+	unsigned int seed = 1;
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+
+	TEST_CHECK(gs1_encoder_validateCheckDigits(ctx, "12345670", 1, 1, 1, valid) == 0);
+	TEST_CHECK(strcmp(gs1_encoder_getErrMsg(ctx), "Keys must have at least two digits") == 0);
+	TEST_CHECK(gs1_encoder_computeCheckDigits(ctx, keys, 8, 7, 1) == 0);
+	TEST_CHECK(strcmp(gs1_encoder_getErrMsg(ctx), "Key stride must be at least the key length") == 0);
+
+	TEST_CHECK(gs1_encoder_validateCheckDigits(ctx, "12345670\n96385074\n12345678", 8, 9, 3, valid) == 2);
+	TEST_CHECK(valid[0] && valid[1] && !valid[2]);
+	TEST_CHECK(gs1_encoder_getErrMsg(ctx)[0] == '\0');
+
+	// Agrees with the scalar check for every key length and alignment
+	for (keyLen = 2; keyLen <= 40; keyLen++) {
+		for (stride = keyLen; stride <= keyLen + 1; stride++) {
+			memset(keys, '\n', sizeof(keys));
+			for (i = 0; i < 64; i++) {
+				for (j = 0; j < keyLen; j++) {
+					seed = seed * 1103515245 + 12345;
+					keys[i * stride + j] = (char)('0' + (seed >> 16) % 10);
+				}
+			}
+			n = gs1_encoder_validateCheckDigits(ctx, keys, keyLen, stride, 64, valid);
+			for (i = 0, j = 0; i < 64; i++) {
+				memcpy(key, &keys[i * stride], keyLen);
+				key[keyLen] = '\0';
+				TEST_CHECK(valid[i] == gs1_validateParity((uint8_t*)key));
+				j += valid[i];
+			}
+			TEST_CHECK(n == j);
+			TEST_CHECK(gs1_encoder_computeCheckDigits(ctx, keys, keyLen, stride, 64) == 64);
+			TEST_CHECK(gs1_encoder_validateCheckDigits(ctx, keys, keyLen, stride, 64, valid) == 64);
+			for (i = 0; i < 64; i++) {
+				memcpy(key, &keys[i * stride], keyLen);
+				key[keyLen] = '\0';
+				TEST_CHECK(gs1_validateParity((uint8_t*)key));
+			}
+		}
+	}
+
+	// Non-digits
+	memcpy(keys, "1234567X12345670123456/0", 24);
+	TEST_CHECK(gs1_encoder_validateCheckDigits(ctx, keys, 8, 8, 3, valid) == 1);
+	TEST_CHECK(!valid[0] && valid[1] && !valid[2]);
+	memcpy(keys, "1234567X1234A67X", 16);
+	TEST_CHECK(gs1_encoder_computeCheckDigits(ctx, keys, 8, 8, 2) == 1);
+	TEST_CHECK(strcmp(gs1_encoder_getErrMsg(ctx), "Key 1 contains a non-digit character") == 0);
+	TEST_CHECK(memcmp(keys, "12345670", 8) == 0);
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+void test_api_outputBuffer(void) {
+
+	gs1_encoder* ctx;
+	static uint8_t expect[65536], user[65536];
+	uint8_t *buf, *prev;
+	size_t size;
+	int i, f;
+	static const int formats[] = {
+		gs1_encoder_dBMP, gs1_encoder_dTIF, gs1_encoder_dRAW, gs1_encoder_dSVG,
+		gs1_encoder_dEPS, gs1_encoder_dPDF, gs1_encoder_dZPL, gs1_encoder_dESCPOS,
+	};
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+	TEST_CHECK(gs1_encoder_setPixMult(ctx, 2));
+	TEST_CHECK(gs1_encoder_setYundercut(ctx, 1));
+
+	TEST_CHECK(!gs1_encoder_setOutputBuffer(ctx, NULL, 10));
+	TEST_CHECK(!gs1_encoder_setOutputBuffer(ctx, user, 0));
+
+	for (i = 0; i < (int)SIZEOF_ARRAY(test_symbols); i++) {
+
+		test_setSymbol(ctx, i);
+
+		for (f = 0; f < (int)SIZEOF_ARRAY(formats); f++) {
+
+			TEST_CHECK(gs1_encoder_setFormat(ctx, formats[f]));
+			TEST_CHECK(gs1_encoder_setOutFile(ctx, ""));
+			TEST_CHECK(gs1_encoder_setOutputBuffer(ctx, NULL, 0));
+			TEST_ASSERT(gs1_encoder_encode(ctx));
+			size = gs1_encoder_getBuffer(ctx, (void*)&buf);
+			TEST_ASSERT(size > 0 && size <= sizeof(expect) - 1);
+			memcpy(expect, buf, size);
+
+			// Measuring gives the exact size and leaves the output intact
+			TEST_CHECK(gs1_encoder_getOutputSize(ctx) == size);
+			TEST_MSG("Format %d: Got %zu; Expected %zu", formats[f], gs1_encoder_getOutputSize(ctx), size);
+			TEST_CHECK(gs1_encoder_getBuffer(ctx, (void*)&buf) == size);
+			TEST_CHECK(memcmp(buf, expect, size) == 0);
+
+			// Render into an exactly sized user buffer
+			memset(user, 0xA5, sizeof(user));
+			TEST_CHECK(gs1_encoder_setOutputBuffer(ctx, user, size));
+			TEST_ASSERT(gs1_encoder_encode(ctx));
+			TEST_CHECK(gs1_encoder_getBuffer(ctx, (void*)&buf) == size);
+			TEST_MSG("Format %d: Got %zu; Expected %zu", formats[f], gs1_encoder_getBuffer(ctx, (void*)&buf), size);
+			TEST_CHECK(buf == user);
+			TEST_CHECK(memcmp(user, expect, size) == 0);
+			TEST_CHECK(user[size] == 0xA5);
+
+			// A buffer that is too small is not overrun
+			memset(user, 0xA5, sizeof(user));
+			TEST_CHECK(gs1_encoder_setOutputBuffer(ctx, user, size - 1));
+			TEST_CHECK(!gs1_encoder_encode(ctx));
+			TEST_CHECK(strcmp(gs1_encoder_getErrMsg(ctx), "Output buffer is too small") == 0);
+			TEST_CHECK(gs1_encoder_getBuffer(ctx, (void*)&buf) == 0);
+			TEST_CHECK(user[size - 1] == 0xA5);
+
+		}
+
+	}
+
+	// A retained buffer is reused by each encode
+	TEST_CHECK(gs1_encoder_setOutputBuffer(ctx, NULL, 0));
+	TEST_CHECK(!gs1_encoder_getRetainBuffer(ctx));
+	TEST_CHECK(gs1_encoder_setRetainBuffer(ctx, true));
+	TEST_CHECK(gs1_encoder_getRetainBuffer(ctx));
+	TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dRAW));
+	TEST_CHECK(gs1_encoder_setSym(ctx, gs1_encoder_sQR));
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "^0112312312312333^10ABC123^99XYZ1234567890"));
+	TEST_ASSERT(gs1_encoder_encode(ctx));
+	TEST_CHECK(gs1_encoder_getBuffer(ctx, (void*)&prev) > 0);
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "^0112312312312333"));
+	TEST_ASSERT(gs1_encoder_encode(ctx));
+	TEST_CHECK(gs1_encoder_getBuffer(ctx, (void*)&buf) > 0);
+	TEST_CHECK(buf == prev);
+	TEST_CHECK(gs1_encoder_setRetainBuffer(ctx, false));
+
+	// The user buffer is not freed with the context
+	TEST_CHECK(gs1_encoder_setOutputBuffer(ctx, user, sizeof(user)));
+	TEST_ASSERT(gs1_encoder_encode(ctx));
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+static void test_errCode(gs1_encoder *ctx, const bool ok, const int code, const char *ai, const int offset, const char *msg) {
+
+	TEST_CHECK(!ok);
+	TEST_CHECK(ctx->errMsg[0] == '\0');	// Not yet formatted
+	TEST_CHECK(gs1_encoder_getErrCode(ctx) == code);
+	TEST_MSG("Got: %d; Expected: %d", gs1_encoder_getErrCode(ctx), code);
+	TEST_CHECK(strcmp(gs1_encoder_getErrAI(ctx), ai) == 0);
+	TEST_MSG("Got: %s; Expected: %s", gs1_encoder_getErrAI(ctx), ai);
+	TEST_CHECK(gs1_encoder_getErrOffset(ctx) == offset);
+	TEST_MSG("Got: %d; Expected: %d", gs1_encoder_getErrOffset(ctx), offset);
+	TEST_CHECK(strcmp(gs1_encoder_getErrMsg(ctx), msg) == 0);
+	TEST_MSG("Got: %s; Expected: %s", gs1_encoder_getErrMsg(ctx), msg);
+
+}
+
+void test_api_errCodes(void) {
+
+	gs1_encoder* ctx;
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+
+	TEST_CHECK(gs1_encoder_getErrCode(ctx) == gs1_encoder_eNONE);
+	TEST_CHECK(gs1_encoder_getErrOffset(ctx) == -1);
+
+	test_errCode(ctx, gs1_encoder_setDataStr(ctx, "^0112345678901234"),
+		gs1_encoder_eAI_CHECK_DIGIT, "01", 13, "AI (01): Incorrect check digit");
+	test_errCode(ctx, gs1_encoder_setDataStr(ctx, "^011234567890123110ABC~"),
+		gs1_encoder_eAI_CSET82, "10", 3, "AI (10): Incorrect CSET 82 character");
+	test_errCode(ctx, gs1_encoder_setAIdataStr(ctx, "(8010)ABc123"),
+		gs1_encoder_eAI_CSET39, "8010", 2, "AI (8010): Incorrect CSET 39 character");
+	test_errCode(ctx, gs1_encoder_setDataStr(ctx, "^171234"),
+		gs1_encoder_eAI_COMPONENT_TOO_SHORT, "17", 4, "AI (17) data is too short");
+	test_errCode(ctx, gs1_encoder_setDataStr(ctx, "^0112345678901231^ZZZZZ"),
+		gs1_encoder_eAI_NO_KNOWN_PREFIX, "ZZZZ", -1, "No known AI is a prefix of: ZZZZ...");
+	test_errCode(ctx, gs1_encoder_setAIdataStr(ctx, "(17)12345A"),
+		gs1_encoder_eAI_NON_DIGIT, "17", 5, "AI (17): Illegal non-digit character");
+	test_errCode(ctx, gs1_encoder_setAIdataStr(ctx, "(10)AB^C"),
+		gs1_encoder_eAI_ILLEGAL_CARET, "10", 2, "AI (10) contains illegal ^ character");
+	test_errCode(ctx, gs1_encoder_setAIdataStr(ctx, "(999)1"),
+		gs1_encoder_eAI_UNRECOGNISED, "999", -1, "Unrecognised AI: 999");
+	test_errCode(ctx, gs1_encoder_setAIdataStr(ctx, "(10"),
+		gs1_encoder_eAI_PARSE_FAILED, "", -1, "Failed to parse AI data");
+	test_errCode(ctx, gs1_encoder_setDataStr(ctx, "https://example.com/01/12345678901234"),
+		gs1_encoder_eAI_CHECK_DIGIT, "01", 13, "AI (01): Incorrect check digit");
+	test_errCode(ctx, gs1_encoder_setDataStr(ctx, "https://example.com/01/12345678901231?99=ABC&123=X"),
+		gs1_encoder_eDL_QUERY_UNKNOWN_AI, "123", -1, "Unknown AI (123) in query parameters");
+	test_errCode(ctx, gs1_encoder_setScanData(ctx, "]E0950123456789X"),
+		gs1_encoder_eSCAN_PRIMARY_NON_DIGIT, "", -1, "Primary message number only contain digits");
+
+	// Messages are formatted only once
+	TEST_CHECK(gs1_encoder_getErrMsg(ctx) == gs1_encoder_getErrMsg(ctx));
+
+	// Errors without a code
+	TEST_CHECK(!gs1_encoder_setPixMult(ctx, 0));
+	TEST_CHECK(gs1_encoder_getErrCode(ctx) == gs1_encoder_eOTHER);
+	TEST_CHECK(gs1_encoder_getErrMsg(ctx)[0] != '\0');
+	TEST_CHECK(gs1_encoder_getErrOffset(ctx) == -1);
+
+	// Success clears the error
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "^0112345678901231"));
+	TEST_CHECK(gs1_encoder_getErrCode(ctx) == gs1_encoder_eNONE);
+	TEST_CHECK(gs1_encoder_getErrAI(ctx)[0] == '\0');
+	TEST_CHECK(gs1_encoder_getErrOffset(ctx) == -1);
+	TEST_CHECK(gs1_encoder_getErrMsg(ctx)[0] == '\0');
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+void test_api_validateAIassociations(void) {
+
+	gs1_encoder* ctx;
+	char buf[64];
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+
+	TEST_CHECK(!gs1_encoder_getValidateAIassociations(ctx));	// Default
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "^10ABC"));
+
+	TEST_CHECK(gs1_encoder_setValidateAIassociations(ctx, true));	// Set
+	TEST_CHECK(gs1_encoder_getValidateAIassociations(ctx));
+
+	TEST_CHECK(!gs1_encoder_setDataStr(ctx, "^10ABC"));
+	TEST_CHECK(gs1_encoder_getErrCode(ctx) == gs1_encoder_eAI_REQUISITE_MISSING);
+	TEST_CHECK(strcmp(gs1_encoder_getErrAI(ctx), "10") == 0);
+	TEST_CHECK(strcmp(gs1_encoder_getDataStr(ctx), "") == 0);
+
+	TEST_CHECK(!gs1_encoder_setAIdataStr(ctx, "(01)12345678901231(02)12345678901231(37)5"));
+	TEST_CHECK(gs1_encoder_getErrCode(ctx) == gs1_encoder_eAI_INVALID_PAIR);
+	TEST_CHECK(strcmp(gs1_encoder_getErrMsg(ctx), "It is invalid to pair AI (01) with AI (02)") == 0);
+
+	// Rules apply across the components of a composite symbol
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "^0112345678901231|^10ABC"));
+	strcpy(buf, "(01)12345678901231|(10)ABC");
+	TEST_CHECK(gs1_encoder_setAIdataStr(ctx, buf));
+	strcpy(buf, "(99)ABC|(10)ABC");
+	TEST_CHECK(!gs1_encoder_setAIdataStr(ctx, buf));
+
+	// The primary message of an EAN/UPC composite is a GTIN
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "2112345678900|^10ABC"));
+	TEST_CHECK(gs1_encoder_setScanData(ctx, "]E02112345678900|]e010ABC"));
+	TEST_CHECK(!gs1_encoder_setScanData(ctx, "]C110ABC"));
+
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "https://example.com/01/12345678901231?10=ABC"));
+	TEST_CHECK(!gs1_encoder_setDataStr(ctx, "https://example.com/00/123456789012345675?10=ABC"));
+
+	TEST_CHECK(gs1_encoder_setValidateAIassociations(ctx, false));	// Reset
+	TEST_CHECK(!gs1_encoder_getValidateAIassociations(ctx));
+	TEST_CHECK(gs1_encoder_setDataStr(ctx, "^10ABC"));
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+static void test_setAIs(gs1_encoder *ctx, const gs1_encoder_ai *ais, const size_t num, const char *aiDataStr) {
+
+	char buf[256], expect[MAX_DATA+1];
+	int numAIs;
+
+	TEST_CASE(aiDataStr);
+
+	// Agrees with parsing the equivalent bracketed AI data
+	strcpy(buf, aiDataStr);
+	TEST_ASSERT(gs1_encoder_setAIdataStr(ctx, buf));
+	strcpy(expect, gs1_encoder_getDataStr(ctx));
+	numAIs = ctx->numAIs;
+
+	TEST_CHECK(gs1_encoder_setAIs(ctx, ais, num));
+	TEST_CHECK(strcmp(gs1_encoder_getDataStr(ctx), expect) == 0);
+	TEST_MSG("Got: %s; Expected: %s", gs1_encoder_getDataStr(ctx), expect);
+	TEST_CHECK(ctx->numAIs == numAIs);
+	TEST_CHECK(strcmp(gs1_encoder_getAIdataStr(ctx), aiDataStr) == 0);
+	TEST_MSG("Got: %s; Expected: %s", gs1_encoder_getAIdataStr(ctx), aiDataStr);
+
+}
+
+void test_api_setAIs(void) {
+
+	gs1_encoder* ctx;
+	static const gs1_encoder_ai gtin[] = { { "01", "12345678901231", 14 } };
+	static const gs1_encoder_ai multi[] = {
+		{ "01", "12345678901231", 14 },
+		{ "10", "ABC(123)", 8 },
+		{ "11", "991225", 6 },
+		{ "99", "XYZ1234567890", 13 },
+	};
+	static const gs1_encoder_ai composite[] = {
+		{ "01", "12345678901231", 14 },
+		{ NULL, NULL, 0 },
+		{ "10", "ABC123XXX", 6 },	// Value need not be terminated
+		{ "21", "XYZ", 3 },
+	};
+	static const gs1_encoder_ai badcsum[] = { { "01", "12345678901234", 14 } };
+	static const gs1_encoder_ai unknown[] = { { "01", "12345678901231", 14 }, { "999", "ABC", 3 } };
+	static const gs1_encoder_ai badai[] = { { "1", "ABC", 3 } };
+	static const gs1_encoder_ai toolong[] = { { "01", "123456789012312", 15 } };
+	static const gs1_encoder_ai caret[] = { { "10", "AB^C", 4 } };
+	static const gs1_encoder_ai empty[] = { { "10", "", 0 } };
+	static const gs1_encoder_ai twoseps[] = { { "01", "12345678901231", 14 }, { NULL, NULL, 0 }, { "10", "A", 1 }, { NULL, NULL, 0 }, { "21", "B", 1 } };
+	static const gs1_encoder_ai lastsep[] = { { "01", "12345678901231", 14 }, { NULL, NULL, 0 } };
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+
+	test_setAIs(ctx, gtin, SIZEOF_ARRAY(gtin), "(01)12345678901231");
+	test_setAIs(ctx, multi, SIZEOF_ARRAY(multi), "(01)12345678901231(10)ABC\\(123)(11)991225(99)XYZ1234567890");
+	test_setAIs(ctx, composite, SIZEOF_ARRAY(composite), "(01)12345678901231|(10)ABC123(21)XYZ");
+
+	TEST_CHECK(!gs1_encoder_setAIs(ctx, badcsum, SIZEOF_ARRAY(badcsum)));
+	TEST_CHECK(gs1_encoder_getErrCode(ctx) == gs1_encoder_eAI_CHECK_DIGIT);
+	TEST_CHECK(gs1_encoder_getErrOffset(ctx) == 13);
+	TEST_CHECK(strcmp(gs1_encoder_getDataStr(ctx), "") == 0);
+
+	TEST_CHECK(!gs1_encoder_setAIs(ctx, unknown, SIZEOF_ARRAY(unknown)));
+	TEST_CHECK(strcmp(gs1_encoder_getErrMsg(ctx), "Unrecognised AI: 999") == 0);
+	TEST_CHECK(!gs1_encoder_setAIs(ctx, badai, SIZEOF_ARRAY(badai)));
+	TEST_CHECK(gs1_encoder_getErrCode(ctx) == gs1_encoder_eAI_UNRECOGNISED);
+	TEST_CHECK(!gs1_encoder_setAIs(ctx, toolong, SIZEOF_ARRAY(toolong)));
+	TEST_CHECK(gs1_encoder_getErrCode(ctx) == gs1_encoder_eAI_VALUE_TOO_LONG);
+	TEST_CHECK(!gs1_encoder_setAIs(ctx, caret, SIZEOF_ARRAY(caret)));
+	TEST_CHECK(gs1_encoder_getErrCode(ctx) == gs1_encoder_eAI_ILLEGAL_CARET);
+	TEST_CHECK(!gs1_encoder_setAIs(ctx, empty, SIZEOF_ARRAY(empty)));
+	TEST_CHECK(gs1_encoder_getErrCode(ctx) == gs1_encoder_eAI_VALUE_TOO_SHORT);
+	TEST_CHECK(!gs1_encoder_setAIs(ctx, twoseps, SIZEOF_ARRAY(twoseps)));
+	TEST_CHECK(!gs1_encoder_setAIs(ctx, lastsep, SIZEOF_ARRAY(lastsep)));
+	TEST_CHECK(!gs1_encoder_setAIs(ctx, gtin, 0));
+	TEST_CHECK(gs1_encoder_getErrCode(ctx) == gs1_encoder_eAI_DATA_EMPTY);
+	TEST_CHECK(ctx->numAIs == 0);
+
+	// Encodes as for the bracketed input
+	TEST_CHECK(gs1_encoder_setSym(ctx, gs1_encoder_sQR));
+	TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dRAW));
+	TEST_CHECK(gs1_encoder_setOutFile(ctx, ""));
+	TEST_CHECK(gs1_encoder_setAIs(ctx, multi, SIZEOF_ARRAY(multi)));
+	TEST_CHECK(gs1_encoder_encode(ctx));
+
+	gs1_encoder_free(ctx);
+
+}
+
+
 #endif  /* UNIT_TESTS */
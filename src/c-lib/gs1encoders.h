@@ -252,11 +252,17 @@ enum gs1_encoder_symbologies {
 
 
 /// Barcode images can be written in common BMP and TIFF graphical formats, as
-/// well as output as a headerless matrix.
+/// well as output as a headerless matrix, as vector graphics, or as printer
+/// commands.
 enum gs1_encoder_formats {
 	gs1_encoder_dBMP = 0,			///< BMP format
 	gs1_encoder_dTIF = 1,			///< TIFF format
 	gs1_encoder_dRAW = 2,			///< TIFF, without header (1-bit per pixel matrix with byte-aligned rows)
+	gs1_encoder_dSVG = 3,			///< SVG format
+	gs1_encoder_dEPS = 4,			///< Encapsulated PostScript format
+	gs1_encoder_dPDF = 5,			///< PDF format
+	gs1_encoder_dZPL = 6,			///< Zebra ZPL compressed graphic field (^GF)
+	gs1_encoder_dESCPOS = 7,		///< ESC/POS raster bit image (GS v 0)
 };
 
 
@@ -380,6 +386,61 @@ enum gs1_encoder_qrVersion {
 };
 
 
+/// A QR Code symbol is masked with one of eight patterns. The strategy
+/// determines how the mask is chosen.
+enum gs1_encoder_qrMaskStrategy {
+	gs1_encoder_qrMaskEvaluate = 0,		///< Score every mask and pick the best
+	gs1_encoder_qrMaskFast,			///< Score a sample of the rows and columns of each mask
+	gs1_encoder_qrMaskFixed,		///< Use the mask set by gs1_encoder_setQrMask()
+};
+
+
+/// Codes identifying the errors that are detected while processing AI
+/// data, Digital Link URIs and scan data. Other errors, such as invalid
+/// settings, have the code ::gs1_encoder_eOTHER.
+enum gs1_encoder_errCodes {
+	gs1_encoder_eNONE = 0,			///< No error
+	gs1_encoder_eOTHER,			///< An error without a specific code, given only by its message
+	gs1_encoder_eTOO_MANY_AIS,		///< The data contains too many AIs
+	gs1_encoder_eMISSING_FNC1_IN_FIRST,	///< AI data does not begin with FNC1
+	gs1_encoder_eAI_DATA_EMPTY,		///< AI data contains no AIs
+	gs1_encoder_eAI_PARSE_FAILED,		///< Bracketed AI data is malformed
+	gs1_encoder_eAI_UNRECOGNISED,		///< Bracketed AI is not recognised
+	gs1_encoder_eAI_NO_KNOWN_PREFIX,	///< No known AI is a prefix of the data
+	gs1_encoder_eAI_VALUE_EMPTY,		///< AI value is empty
+	gs1_encoder_eAI_VALUE_TOO_SHORT,	///< AI value is shorter than the minimum for the AI
+	gs1_encoder_eAI_VALUE_TOO_LONG,		///< AI value is longer than the maximum for the AI
+	gs1_encoder_eAI_COMPONENT_TOO_SHORT,	///< AI value ends before a component reaches its minimum length
+	gs1_encoder_eAI_DATA_TOO_LONG,		///< AI value requiring FNC1 is followed by more data
+	gs1_encoder_eAI_ILLEGAL_CARET,		///< AI value contains a "^" character
+	gs1_encoder_eAI_NON_DIGIT,		///< Numeric AI component contains a non-digit character
+	gs1_encoder_eAI_CSET82,			///< AI component contains a character outside of CSET 82
+	gs1_encoder_eAI_CHECK_DIGIT,		///< AI component has an incorrect check digit
+	gs1_encoder_eAI_CSUMALPHA_TOO_SHORT,	///< AI component is too short for alphanumeric check characters
+	gs1_encoder_eAI_CSUMALPHA_TOO_LONG,	///< AI component is too long for alphanumeric check characters
+	gs1_encoder_eAI_CSUMALPHA_CHECK,	///< AI component has incorrect alphanumeric check characters
+	gs1_encoder_eDL_PARSE_FAILED,		///< Digital Link URI is malformed
+	gs1_encoder_eDL_ILLEGAL_CHARACTER,	///< Digital Link URI contains a character that is not permitted in URIs
+	gs1_encoder_eDL_SCHEME,			///< Digital Link URI scheme is not http:// or https://
+	gs1_encoder_eDL_NO_PATH_INFO,		///< Digital Link URI has no domain or path info
+	gs1_encoder_eDL_NO_KEYS,		///< Digital Link URI path info contains no GS1 key
+	gs1_encoder_eDL_PATH_VALUE_TOO_LONG,	///< Decoded Digital Link path info value is too long
+	gs1_encoder_eDL_QUERY_UNKNOWN_AI,	///< Digital Link query parameter is numeric but not a known AI
+	gs1_encoder_eDL_QUERY_VALUE_TOO_LONG,	///< Decoded Digital Link query parameter value is too long
+	gs1_encoder_eSCAN_MISSING_SYMBOLOGY_ID,	///< Scan data has no symbology identifier
+	gs1_encoder_eSCAN_UNSUPPORTED_SYMBOLOGY_ID,	///< Scan data symbology identifier is not supported
+	gs1_encoder_eSCAN_PRIMARY_TOO_SHORT,	///< Scan data is shorter than the primary message
+	gs1_encoder_eSCAN_PRIMARY_TOO_LONG,	///< Scan data continues beyond the primary message without a composite component
+	gs1_encoder_eSCAN_PRIMARY_NON_DIGIT,	///< Primary message contains a non-digit character
+	gs1_encoder_eSCAN_PRIMARY_CHECK_DIGIT,	///< Primary message has an incorrect check digit
+	gs1_encoder_eSCAN_ILLEGAL_CARET,	///< Scan data contains a "^" character
+	gs1_encoder_eAI_REQUISITE_MISSING,	///< AI requires an accompanying AI that is not present
+	gs1_encoder_eAI_INVALID_PAIR,		///< AI is accompanied by an AI with which it must not be used
+	gs1_encoder_eAI_CSET39,			///< AI component contains a character outside of CSET 39
+	gs1_encoder_eNUMERRCODES,		///< Value is the number of error codes
+};
+
+
 /**
  * @brief A gs1_encoder context.
  *
@@ -411,6 +472,28 @@ enum gs1_encoder_qrVersion {
 typedef struct gs1_encoder gs1_encoder;
 
 
+/**
+ * @brief A gs1_encoder_pool is an opaque set of workers, each with its own
+ * ::gs1_encoder instance, that is used to encode batches of messages across
+ * multiple threads.
+ *
+ * @see gs1_encoder_poolInit()
+ *
+ */
+typedef struct gs1_encoder_pool gs1_encoder_pool;
+
+
+/**
+ * @brief An AI and its value, as given to gs1_encoder_setAIs().
+ *
+ */
+typedef struct gs1_encoder_ai {
+	const char *ai;		///< The AI, e.g. "01", or NULL to separate the linear and 2D components of a composite symbol
+	const char *value;	///< The AI value, which need not be NUL-terminated
+	size_t length;		///< Length of the AI value in bytes
+} gs1_encoder_ai;
+
+
 /**
  * @brief Get the version string of the library.
  *
@@ -533,6 +616,12 @@ GS1_ENCODERS_API int gs1_encoder_getMaxGS1_128LinearHeight(void);
  * returned by gs1_encoder_instanceSize() and this buffer should not be reused
  * or freed until gs1_encoder_free() is called.
  *
+ * The large working areas that are only required by certain symbologies are
+ * not part of the instance. They are allocated when first needed and are
+ * retained until gs1_encoder_free() is called, so that an instance used only
+ * for small symbols remains small. Builds created with NOMALLOC defined
+ * instead hold these working areas within the instance.
+ *
  * @see gs1_encoder_instanceSize()
  *
  * @param [in,out] mem buffer to use for storage, or NULL for automatic allocation
@@ -559,6 +648,53 @@ GS1_ENCODERS_API gs1_encoder* gs1_encoder_init(void *mem);
 GS1_ENCODERS_API char* gs1_encoder_getErrMsg(gs1_encoder *ctx);
 
 
+/**
+ * @brief Get the code identifying the error that was generated by the
+ * library.
+ *
+ * This is an inexpensive alternative to gs1_encoder_getErrMsg() for
+ * classifying the data that fails validation. The error message is only
+ * generated when gs1_encoder_getErrMsg() is called.
+ *
+ * @see gs1_encoder_getErrAI()
+ * @see gs1_encoder_getErrOffset()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @return one of ::gs1_encoder_errCodes, or ::gs1_encoder_eNONE if there is no error
+ */
+GS1_ENCODERS_API int gs1_encoder_getErrCode(gs1_encoder *ctx);
+
+
+/**
+ * @brief Get the AI associated with the error that was generated by the
+ * library.
+ *
+ * For errors concerning an unrecognised AI this is the AI that was given in
+ * the input.
+ *
+ * @see gs1_encoder_getErrCode()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @return the AI, or the empty string if the error does not concern a particular AI
+ */
+GS1_ENCODERS_API const char* gs1_encoder_getErrAI(gs1_encoder *ctx);
+
+
+/**
+ * @brief Get the position within the AI value at which the error that was
+ * generated by the library was detected.
+ *
+ * For example, this is the position of an invalid character, of an incorrect
+ * check digit, or of the first character beyond the permitted length.
+ *
+ * @see gs1_encoder_getErrCode()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @return the offset in bytes from the start of the AI value, or -1 if the error does not concern a position within an AI value
+ */
+GS1_ENCODERS_API int gs1_encoder_getErrOffset(gs1_encoder *ctx);
+
+
 /**
  * @brief Get the current symbology type.
  *
@@ -1080,6 +1216,73 @@ GS1_ENCODERS_API int gs1_encoder_getQrEClevel(gs1_encoder *ctx);
 GS1_ENCODERS_API bool gs1_encoder_setQrEClevel(gs1_encoder *ctx, int ecLevel);
 
 
+/**
+ * @brief Get the current mask selection strategy for QR Code symbols.
+ *
+ * @see gs1_encoder_setQrMaskStrategy()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @return current strategy, one of ::gs1_encoder_qrMaskStrategy
+ */
+GS1_ENCODERS_API int gs1_encoder_getQrMaskStrategy(gs1_encoder *ctx);
+
+
+/**
+ * @brief Set how the mask is selected for QR Code symbols.
+ *
+ * ::gs1_encoder_qrMaskEvaluate scores all eight masks using the penalty
+ * rules of ISO/IEC 18004 and picks the lowest score.
+ *
+ * ::gs1_encoder_qrMaskFast scores only every fourth row and column of each
+ * mask. This is much quicker for large symbols but it may pick a mask that a
+ * full evaluation scores slightly worse.
+ *
+ * ::gs1_encoder_qrMaskFixed skips the evaluation and always uses the mask
+ * set by gs1_encoder_setQrMask().
+ *
+ * Default is ::gs1_encoder_qrMaskEvaluate
+ *
+ * @see ::gs1_encoder_qrMaskStrategy
+ * @see gs1_encoder_getQrMaskStrategy()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [in] strategy mask selection strategy, one of ::gs1_encoder_qrMaskStrategy
+ * @return true on success, otherwise false and an error message is set that can be read using gs1_encoder_getErrMsg()
+ */
+GS1_ENCODERS_API bool gs1_encoder_setQrMaskStrategy(gs1_encoder *ctx, int strategy);
+
+
+/**
+ * @brief Get the mask that is used for QR Code symbols with the
+ * ::gs1_encoder_qrMaskFixed strategy.
+ *
+ * @see gs1_encoder_setQrMask()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @return current fixed mask, 0 to 7
+ */
+GS1_ENCODERS_API int gs1_encoder_getQrMask(gs1_encoder *ctx);
+
+
+/**
+ * @brief Set the mask that is used for QR Code symbols with the
+ * ::gs1_encoder_qrMaskFixed strategy.
+ *
+ * Default is 0
+ *
+ * \note
+ * Valid values are the mask pattern references 0 to 7
+ *
+ * @see gs1_encoder_setQrMaskStrategy()
+ * @see gs1_encoder_getQrMask()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [in] mask mask pattern reference
+ * @return true on success, otherwise false and an error message is set that can be read using gs1_encoder_getErrMsg()
+ */
+GS1_ENCODERS_API bool gs1_encoder_setQrMask(gs1_encoder *ctx, int mask);
+
+
 /**
  * @brief Get the current status of the "add check digit" mode.
  *
@@ -1150,6 +1353,93 @@ GS1_ENCODERS_API bool gs1_encoder_getPermitUnknownAIs(gs1_encoder *ctx);
 GS1_ENCODERS_API bool gs1_encoder_setPermitUnknownAIs(gs1_encoder *ctx, bool permitUnknownAIs);
 
 
+/**
+ * @brief Get the current status of the "validate AI associations" mode.
+ *
+ * @see gs1_encoder_setValidateAIassociations()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @return current status of the validate AI associations mode
+ */
+GS1_ENCODERS_API bool gs1_encoder_getValidateAIassociations(gs1_encoder *ctx);
+
+
+/**
+ * @brief Enable or disable "validate AI associations" mode, which checks the
+ * relationships between the AIs of a message.
+ *
+ *   * If false (default), then each AI is validated on its own.
+ *   * If true, then the message is also rejected when an AI is present
+ *     without an AI that it requires, such as AI (10) without a GTIN, or
+ *     when it is present together with an AI with which it must not be used,
+ *     such as AI (01) with AI (02).
+ *
+ * The rules are taken from the "req" and "ex" attributes of the syntax
+ * dictionary from which the library was built, or of the compiled syntax
+ * dictionary that is loaded with gs1_encoder_setSyntaxDictionary(). They apply
+ * to the message as a whole, including both components of a composite symbol.
+ *
+ * @see gs1_encoder_getValidateAIassociations()
+ * @see gs1_encoder_getErrCode()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [in] validateAIassociations enabled if true; disabled if false
+ * @return true on success, otherwise false and an error message is set that can be read using gs1_encoder_getErrMsg()
+ */
+GS1_ENCODERS_API bool gs1_encoder_setValidateAIassociations(gs1_encoder *ctx, bool validateAIassociations);
+
+
+/**
+ * @brief Get the compiled syntax dictionary file that is in use.
+ *
+ * @see gs1_encoder_setSyntaxDictionary()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @return the file name, or the empty string if the built-in AI table is in use
+ */
+GS1_ENCODERS_API char* gs1_encoder_getSyntaxDictionary(gs1_encoder *ctx);
+
+
+/**
+ * @brief Use the AI definitions from a compiled syntax dictionary file in
+ * place of the AI table that is built into the library.
+ *
+ * The compiled dictionary is generated from the GS1 syntax dictionary
+ * (gs1-format-spec.txt) as follows:
+ *
+ * \code
+ * perl -T build-gs1-syntax-dict.pl --binary < gs1-format-spec.txt > gs1-syntax-dict.bin
+ * \endcode
+ *
+ * The file holds the AI table and the AI association rules in their in-memory
+ * layout, so it is loaded with a single read and no parsing. The whole file is checked when it is loaded and
+ * an invalid file is rejected, leaving the current AI table in use. Any
+ * previously extracted AIs are discarded.
+ *
+ * The checked table is held in memory that is private to the context, so the
+ * file may be rewritten or replaced while it is in use, for example to roll
+ * out new AIs to running processes. The new file takes effect when it is next
+ * loaded.
+ *
+ * Provide an empty string to revert to the built-in AI table.
+ *
+ * \note
+ * The file must have been generated on a platform with the same byte order,
+ * by a version of build-gs1-syntax-dict.pl that matches the library. Files
+ * generated before the association rules were included are rejected.
+ *
+ * \note
+ * Builds created with NOMALLOC defined do not support syntax dictionaries.
+ *
+ * @see gs1_encoder_getSyntaxDictionary()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [in] file the compiled syntax dictionary file, or the empty string
+ * @return true on success, otherwise false and an error message is set that can be read using gs1_encoder_getErrMsg()
+ */
+GS1_ENCODERS_API bool gs1_encoder_setSyntaxDictionary(gs1_encoder *ctx, const char *file);
+
+
 /**
  * @brief Indicates whether barcode data input is currently taken from a buffer
  * or a file.
@@ -1344,6 +1634,44 @@ GS1_ENCODERS_API bool gs1_encoder_setDataStr(gs1_encoder *ctx, const char *dataS
 GS1_ENCODERS_API bool gs1_encoder_setAIdataStr(gs1_encoder *ctx, const char *dataStr);
 
 
+/**
+ * @brief Sets the data to be encoded from AIs that are given as separate
+ * values.
+ *
+ * This is an alternative to gs1_encoder_setAIdataStr() for applications that
+ * already hold each AI and its value separately, which avoids formatting the
+ * values into bracketed AI syntax only for the library to parse them apart.
+ * The values are used as given: no escaping of "(" characters is required.
+ *
+ * For example:
+ *
+ * \code
+ * gs1_encoder_ai ais[] = {
+ *     { "01", "12345678901231", 14 },
+ *     { "10", "ABC123", 6 },
+ * };
+ * gs1_encoder_setAIs(ctx, ais, 2);
+ * \endcode
+ *
+ * Each value is validated against the same rules as for
+ * gs1_encoder_setAIdataStr(), after which the resulting encoding is available
+ * via gs1_encoder_getDataStr().
+ *
+ * For symbologies that support a composite component, an entry with an AI of
+ * NULL separates the AIs of the linear component from those of the 2D
+ * component.
+ *
+ * @see gs1_encoder_setAIdataStr()
+ * @see gs1_encoder_getDataStr()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [in] ais the AIs and their values
+ * @param [in] num the number of entries in ais
+ * @return true on success, otherwise false and an error message is set that can be read using gs1_encoder_getErrMsg()
+ */
+GS1_ENCODERS_API bool gs1_encoder_setAIs(gs1_encoder *ctx, const gs1_encoder_ai *ais, size_t num);
+
+
 /**
  * @brief Return the barcode input data buffer in human-friendly AI syntax
  *
@@ -1615,6 +1943,23 @@ GS1_ENCODERS_API int gs1_encoder_getFormat(gs1_encoder *ctx);
  *   * ::gs1_encoder_dBMP: BMP format
  *   * ::gs1_encoder_dTIF: TIFF format
  *   * ::gs1_encoder_dRAW: TIFF format, without the header
+ *   * ::gs1_encoder_dSVG: SVG format
+ *   * ::gs1_encoder_dEPS: Encapsulated PostScript format
+ *   * ::gs1_encoder_dPDF: PDF format
+ *   * ::gs1_encoder_dZPL: ZPL ^GF graphic field command
+ *   * ::gs1_encoder_dESCPOS: ESC/POS GS v 0 raster commands
+ *
+ * The vector formats describe the same image as the bitmap formats, with one
+ * user space unit per pixel (a "px" for SVG and a point for EPS and PDF). Each
+ * rectangle of dark pixels is drawn as a single filled rectangle so the output
+ * is compact and can be scaled without loss. Setting the pixels per module to
+ * one therefore gives a drawing in units of the X-dimension.
+ *
+ * The printer formats are intended to be inserted into a print job. ZPL
+ * output is a single "^GFA" graphic field command, using ZPL's compressed
+ * ASCII hex encoding and terminated by "^FS", that may follow a field origin
+ * command within a label format. ESC/POS output is a sequence of "GS v 0"
+ * raster bit image commands, each carrying up to 256 lines.
  *
  * @see gs1_encoder_getFormat()
  *
@@ -1667,6 +2012,133 @@ GS1_ENCODERS_API char* gs1_encoder_getOutFile(gs1_encoder *ctx);
 GS1_ENCODERS_API bool gs1_encoder_setOutFile(gs1_encoder *ctx, const char *outFile);
 
 
+/**
+ * @brief Indicates whether the rows of the image are delivered individually.
+ *
+ * @see gs1_encoder_setStreamRows()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @return true if row streaming is enabled
+ */
+GS1_ENCODERS_API bool gs1_encoder_getStreamRows(gs1_encoder *ctx);
+
+
+/**
+ * @brief Selects whether the rows of the image are delivered individually
+ * rather than being accumulated in the output buffer or file.
+ *
+ * When enabled, each raster row of the RAW format image is either passed to
+ * the callback registered with gs1_encoder_setRowCallback() as it is rendered
+ * during gs1_encoder_encode(), or if no callback is registered then it is
+ * rendered on demand by gs1_encoder_nextRow(). In either case the output file
+ * is not written and no output buffer is produced. The dimensions of the
+ * image are available from gs1_encoder_getBufferWidth() and
+ * gs1_encoder_getBufferHeight().
+ *
+ * This avoids the latency and memory needed to hold the complete image, which
+ * otherwise grow with the X-dimension.
+ *
+ * \note
+ * Row streaming requires that the output format is RAW.
+ *
+ * @see gs1_encoder_getStreamRows()
+ * @see gs1_encoder_setRowCallback()
+ * @see gs1_encoder_nextRow()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [in] streamRows enabled if true; disabled if false
+ * @return true on success, otherwise false and an error message is set
+ */
+GS1_ENCODERS_API bool gs1_encoder_setStreamRows(gs1_encoder *ctx, bool streamRows);
+
+
+/**
+ * @brief Callback that receives each row of the image when rows are streamed.
+ *
+ * The row is only valid for the duration of the call.
+ *
+ * @param [in] userData the pointer given to gs1_encoder_setRowCallback()
+ * @param [in] row the row in RAW format
+ * @param [in] length the length of the row in bytes
+ */
+typedef void (*gs1_encoder_rowCallback)(void *userData, const void *row, size_t length);
+
+
+/**
+ * @brief Register a callback that receives each row of the image as it is
+ * rendered when row streaming is enabled.
+ *
+ * @see gs1_encoder_setStreamRows()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [in] callback the function to receive each row, or NULL for rows to be pulled using gs1_encoder_nextRow()
+ * @param [in] userData pointer passed unchanged to the callback
+ * @return true on success, otherwise false and an error message is set
+ */
+GS1_ENCODERS_API bool gs1_encoder_setRowCallback(gs1_encoder *ctx, gs1_encoder_rowCallback callback, void *userData);
+
+
+/**
+ * @brief Indicates whether the output buffer is retained between encodes.
+ *
+ * @see gs1_encoder_setRetainBuffer()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @return true if the output buffer is retained
+ */
+GS1_ENCODERS_API bool gs1_encoder_getRetainBuffer(gs1_encoder *ctx);
+
+
+/**
+ * @brief Selects whether the output buffer keeps its capacity between
+ * encodes.
+ *
+ * By default the output buffer is freed at the start of each call to
+ * gs1_encoder_encode() and is shrunk to fit the output once it has been
+ * rendered. When the buffer is retained it is instead reused by each
+ * subsequent encode and only grows, so that after the largest symbol has been
+ * encoded no further heap allocation is needed for the output.
+ *
+ * @see gs1_encoder_getRetainBuffer()
+ * @see gs1_encoder_setOutputBuffer()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [in] retainBuffer enabled if true; disabled if false
+ * @return true on success, otherwise false and an error message is set
+ */
+GS1_ENCODERS_API bool gs1_encoder_setRetainBuffer(gs1_encoder *ctx, bool retainBuffer);
+
+
+/**
+ * @brief Provide a buffer into which the output is rendered.
+ *
+ * The output of subsequent calls to gs1_encoder_encode() is written directly
+ * into the given buffer rather than into a buffer allocated by the library.
+ * If the output does not fit then the encode fails with an error. The buffer
+ * remains owned by the caller and must remain valid until it is replaced or
+ * the context is freed. Passing NULL with a size of zero reverts to a buffer
+ * allocated by the library.
+ *
+ * The size that is required can be determined beforehand using
+ * gs1_encoder_getOutputSize().
+ *
+ * \note
+ * The working areas used while encoding are allocated on first use and then
+ * retained by the context, so once a symbol of the largest expected size has
+ * been encoded, encoding into a user-provided buffer does not use the heap.
+ * Builds with NOMALLOC defined never use the heap for working areas.
+ *
+ * @see gs1_encoder_getOutputSize()
+ * @see gs1_encoder_getBuffer()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [in] buffer the buffer to receive the output, or NULL
+ * @param [in] size the size of the buffer, or zero
+ * @return true on success, otherwise false and an error message is set
+ */
+GS1_ENCODERS_API bool gs1_encoder_setOutputBuffer(gs1_encoder *ctx, void *buffer, size_t size);
+
+
 /**
  * @brief Generate a barcode symbol representing the given input data
  *
@@ -1691,6 +2163,216 @@ GS1_ENCODERS_API bool gs1_encoder_setOutFile(gs1_encoder *ctx, const char *outFi
 GS1_ENCODERS_API bool gs1_encoder_encode(gs1_encoder *ctx);
 
 
+/**
+ * @brief Generate a barcode symbol as a matrix of modules
+ *
+ * This is equivalent to gs1_encoder_encode() except that the symbol is
+ * rendered into the output buffer with exactly one pixel per module, in RAW
+ * format: one bit per module, MSB first, with a dark module represented by 1
+ * and each row padded to a whole number of bytes. The dimensions of the
+ * matrix are given by gs1_encoder_getBufferWidth() and
+ * gs1_encoder_getBufferHeight().
+ *
+ * This avoids the time and memory spent expanding each module into pixels
+ * for users that scale or draw the symbol themselves.
+ *
+ * The X-dimension, undercut, separator height, output format and output file
+ * settings are ignored for this call and left unchanged. Linear components
+ * are rendered with a single row for each separator.
+ *
+ * @see gs1_encoder_encode()
+ * @see gs1_encoder_getBuffer()
+ * @see gs1_encoder_getBufferStrings()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @return true on success, otherwise false and an error message is set
+ */
+GS1_ENCODERS_API bool gs1_encoder_encodeModules(gs1_encoder *ctx);
+
+
+/**
+ * @brief Determine the size of the output for the current input data and
+ * configuration without storing it.
+ *
+ * For the fixed-size raster formats (BMP, TIF, RAW and ESC/POS) the size is
+ * calculated from the symbol dimensions without rendering the image. For the
+ * other formats the image is rendered but the output is only counted. The
+ * output file and any existing output buffer are left untouched.
+ *
+ * @see gs1_encoder_setOutputBuffer()
+ * @see gs1_encoder_encode()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @return the number of bytes that gs1_encoder_encode() would produce, or 0 if an error message is set
+ */
+GS1_ENCODERS_API size_t gs1_encoder_getOutputSize(gs1_encoder *ctx);
+
+
+/**
+ * @brief Generate a barcode symbol for each of a set of input data strings
+ * using the current configuration, writing the images into a single
+ * user-provided arena.
+ *
+ * Each data string is processed as though it were passed to
+ * gs1_encoder_setDataStr() followed by gs1_encoder_encode(). The resulting
+ * image is appended to the arena and its position is recorded in the given
+ * offsets and sizes arrays.
+ *
+ * The output buffer that is internally used for rendering is retained between
+ * the symbols of the batch, avoiding the per-symbol allocation that occurs
+ * when calling gs1_encoder_encode() repeatedly.
+ *
+ * Processing stops at the first message that cannot be encoded, or that does
+ * not fit in the remaining space of the arena, in which case an error message
+ * is set. The index of the offending message is given by the return value.
+ *
+ * \note
+ * Batch encoding requires that output is directed to a buffer, i.e. that the
+ * output filename is set to the empty string, and that file input is not
+ * selected.
+ *
+ * @see gs1_encoder_encode()
+ * @see gs1_encoder_setOutFile()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [in] dataStrs array of input data strings, as accepted by gs1_encoder_setDataStr()
+ * @param [in] num the number of input data strings
+ * @param [out] arena a pointer to a buffer into which the images are written
+ * @param [in] max the size of the arena
+ * @param [out] offsets array receiving the offset of each image within the arena
+ * @param [out] sizes array receiving the size of each image
+ * @return the number of symbols successfully written to the arena; if fewer than num then an error message is set
+ */
+GS1_ENCODERS_API size_t gs1_encoder_encodeBatch(gs1_encoder *ctx, const char* const *dataStrs, size_t num, void *arena, size_t max, size_t *offsets, size_t *sizes);
+
+
+/**
+ * @brief Validate the mod-10 check digits of a set of fixed-length numeric
+ * keys, such as GTINs, GLNs or SSCCs, in a single call.
+ *
+ * The keys are read from a single buffer, with each key being keyLen digits
+ * (including the check digit) that begin stride bytes after the start of the
+ * previous key. For example, newline-separated GTIN-14s have a keyLen of 14
+ * and a stride of 15. The keys need not be null-terminated.
+ *
+ * A key that contains any non-digit character is reported as invalid.
+ *
+ * @see gs1_encoder_computeCheckDigits()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [in] keys a pointer to the first key
+ * @param [in] keyLen the length of each key, including its check digit
+ * @param [in] stride the distance in bytes between the start of successive keys
+ * @param [in] num the number of keys
+ * @param [out] valid array receiving whether each key has a correct check digit
+ * @return the number of keys with a correct check digit, or 0 with an error message set if the key layout is invalid
+ */
+GS1_ENCODERS_API size_t gs1_encoder_validateCheckDigits(gs1_encoder *ctx, const char *keys, size_t keyLen, size_t stride, size_t num, bool *valid);
+
+
+/**
+ * @brief Compute the mod-10 check digits of a set of fixed-length numeric
+ * keys in a single call, writing each into the final position of its key.
+ *
+ * The keys are laid out as for gs1_encoder_validateCheckDigits(). The
+ * existing content of the check digit position of each key is ignored.
+ *
+ * Processing stops at the first key that contains a non-digit character in
+ * a position other than the check digit, in which case an error message is
+ * set. The index of the offending key is given by the return value.
+ *
+ * @see gs1_encoder_validateCheckDigits()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [in,out] keys a pointer to the first key
+ * @param [in] keyLen the length of each key, including its check digit
+ * @param [in] stride the distance in bytes between the start of successive keys
+ * @param [in] num the number of keys
+ * @return the number of keys whose check digit was written; if fewer than num then an error message is set
+ */
+GS1_ENCODERS_API size_t gs1_encoder_computeCheckDigits(gs1_encoder *ctx, char *keys, size_t keyLen, size_t stride, size_t num);
+
+
+/**
+ * @brief Create a pool of workers for encoding batches of messages in
+ * parallel.
+ *
+ * Each worker holds its own ::gs1_encoder instance that is retained for the
+ * lifetime of the pool.
+ *
+ * \note
+ * Builds created with NOTHREADS defined, or for WebAssembly without thread
+ * support, always create a pool with a single worker that runs on the calling
+ * thread.
+ *
+ * @see gs1_encoder_poolEncodeBatch()
+ * @see gs1_encoder_poolFree()
+ *
+ * @param [in] numWorkers the number of workers, or 0 for one worker per online CPU
+ * @return a pointer to the pool, or NULL if the pool could not be created
+ */
+GS1_ENCODERS_API gs1_encoder_pool* gs1_encoder_poolInit(int numWorkers);
+
+
+/**
+ * @brief Destroy a pool of workers, releasing all of its resources.
+ *
+ * @param [in,out] pool ::gs1_encoder_pool to destroy
+ */
+GS1_ENCODERS_API void gs1_encoder_poolFree(gs1_encoder_pool *pool);
+
+
+/**
+ * @brief Get the number of workers in a pool.
+ *
+ * @param [in] pool ::gs1_encoder_pool
+ * @return the number of workers
+ */
+GS1_ENCODERS_API int gs1_encoder_poolGetNumWorkers(const gs1_encoder_pool *pool);
+
+
+/**
+ * @brief Generate a barcode symbol for each of a set of input data strings
+ * using the workers of a pool, writing the images into a single user-provided
+ * arena.
+ *
+ * The symbol configuration is taken from the given ::gs1_encoder instance,
+ * which also receives any error message. The instance itself is not used for
+ * encoding and may not be used by another thread during the call.
+ *
+ * The messages are shared between the workers and a worker that runs out of
+ * messages takes over part of the remaining work of another, so that batches
+ * containing a mixture of small and large symbols are evenly spread.
+ *
+ * The images are placed in the arena in input order, exactly as
+ * gs1_encoder_encodeBatch() would place them. Unlike that function,
+ * processing does not stop at a message that cannot be encoded: such a
+ * message is given a size of zero and an error message that refers to the
+ * first such message is set. An error message is also set if the arena
+ * becomes full, in which case the remaining messages are given a size of
+ * zero.
+ *
+ * \note
+ * Batch encoding requires that output is directed to a buffer, i.e. that the
+ * output filename is set to the empty string, and that file input is not
+ * selected.
+ *
+ * @see gs1_encoder_encodeBatch()
+ * @see gs1_encoder_poolInit()
+ *
+ * @param [in,out] pool ::gs1_encoder_pool
+ * @param [in,out] ctx ::gs1_encoder context providing the configuration
+ * @param [in] dataStrs array of input data strings, as accepted by gs1_encoder_setDataStr()
+ * @param [in] num the number of input data strings
+ * @param [out] arena a pointer to a buffer into which the images are written
+ * @param [in] max the size of the arena
+ * @param [out] offsets array receiving the offset of each image within the arena
+ * @param [out] sizes array receiving the size of each image, or zero if it was not written
+ * @return the number of symbols successfully written to the arena; if fewer than num then an error message is set
+ */
+GS1_ENCODERS_API size_t gs1_encoder_poolEncodeBatch(gs1_encoder_pool *pool, gs1_encoder *ctx, const char* const *dataStrs, size_t num, void *arena, size_t max, size_t *offsets, size_t *sizes);
+
+
 /**
  * @brief Get the output buffer.
  *
@@ -1769,6 +2451,27 @@ GS1_ENCODERS_API int gs1_encoder_getBufferWidth(gs1_encoder *ctx);
 GS1_ENCODERS_API int gs1_encoder_getBufferHeight(gs1_encoder *ctx);
 
 
+/**
+ * @brief Render and return the next row of the image when rows are streamed
+ * without a callback.
+ *
+ * Each call renders a single RAW format row of the symbol produced by the
+ * most recent call to gs1_encoder_encode(), in top-to-bottom order.
+ *
+ * \note
+ * The content of the row is overwritten by the next call. The configuration
+ * of the instance should not be altered until all rows have been returned.
+ *
+ * @see gs1_encoder_setStreamRows()
+ * @see gs1_encoder_getBufferHeight()
+ *
+ * @param [in,out] ctx ::gs1_encoder context
+ * @param [out] row the value of the given pointer is rewritten to point to the row
+ * @return the length of the row in bytes, or 0 once all rows have been returned
+ */
+GS1_ENCODERS_API size_t gs1_encoder_nextRow(gs1_encoder *ctx, const void **row);
+
+
 /**
  * @brief Return the output buffer represented as an array of strings
  *
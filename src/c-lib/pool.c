@@ -0,0 +1,592 @@
+/**
+ * GS1 Barcode Engine
+ *
+ * @author Copyright (c) 2021 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * A pool of encoder instances that is used to spread a batch of messages
+ * across a number of threads.
+ *
+ * The batch is initially divided into a contiguous range of messages for each
+ * worker. A worker that exhausts its own range steals the upper half of the
+ * remaining range of another worker, so that a worker that is stuck rendering
+ * a few large symbols does not hold up the completion of the batch.
+ *
+ * Each worker renders into its own instance and appends the result to a
+ * private staging area. Once all workers are done the images are collated
+ * into the caller's arena in input order.
+ *
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "enc-private.h"
+#include "gs1encoders.h"
+#include "pool.h"
+
+
+#if defined(NOTHREADS) || (defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__))
+#define POOL_THREADS 0
+#elif defined(_WIN32)
+#define POOL_THREADS 1
+#include <windows.h>
+typedef HANDLE pool_thread_t;
+typedef CRITICAL_SECTION pool_mutex_t;
+#define pool_mutexInit(m)	(InitializeCriticalSection(m), true)
+#define pool_mutexDestroy(m)	DeleteCriticalSection(m)
+#define pool_mutexLock(m)	EnterCriticalSection(m)
+#define pool_mutexUnlock(m)	LeaveCriticalSection(m)
+#else
+#define POOL_THREADS 1
+#include <pthread.h>
+#include <unistd.h>
+typedef pthread_t pool_thread_t;
+typedef pthread_mutex_t pool_mutex_t;
+#define pool_mutexInit(m)	(pthread_mutex_init(m, NULL) == 0)
+#define pool_mutexDestroy(m)	pthread_mutex_destroy(m)
+#define pool_mutexLock(m)	pthread_mutex_lock(m)
+#define pool_mutexUnlock(m)	pthread_mutex_unlock(m)
+#endif
+
+#if !POOL_THREADS
+#define pool_mutexInit(m)	((void)(m), true)
+#define pool_mutexDestroy(m)	(void)(m)
+#define pool_mutexLock(m)	(void)(m)
+#define pool_mutexUnlock(m)	(void)(m)
+typedef int pool_mutex_t;
+#endif
+
+
+struct poolResult {
+	int worker;			// Worker whose staging area holds the image
+	size_t offset;			// Offset of the image within the staging area
+	size_t size;			// Zero if the message failed to encode
+};
+
+struct poolBatch {
+	const char* const *dataStrs;
+	struct poolResult *results;
+};
+
+struct poolWorker {
+	gs1_encoder_pool *pool;
+	int id;
+	gs1_encoder *ctx;		// Retained between batches
+	pool_mutex_t lock;		// Guards next and end
+	size_t next;			// Remaining range of messages is [next, end)
+	size_t end;
+	uint8_t *stage;			// Images rendered by this worker
+	size_t stageCap;
+	size_t stageSize;
+	size_t errIdx;			// First message that failed, or SIZE_MAX
+	char errMsg[sizeof(((gs1_encoder*)0)->errMsg)];
+	bool allocErr;
+#if POOL_THREADS
+	pool_thread_t thread;
+#endif
+};
+
+struct gs1_encoder_pool {
+	int numWorkers;
+	struct poolWorker *workers;
+	struct poolBatch batch;		// Batch currently being processed
+};
+
+
+static int onlineCPUs(void) {
+
+#if POOL_THREADS && defined(_WIN32)
+	SYSTEM_INFO si;
+	GetSystemInfo(&si);
+	return (int)si.dwNumberOfProcessors;
+#elif POOL_THREADS && defined(_SC_NPROCESSORS_ONLN)
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n > 0 ? (int)n : 1;
+#else
+	return 1;
+#endif
+
+}
+
+
+/*
+ *  Give a worker's instance the same symbol configuration as the caller's,
+ *  with output always directed to a buffer.
+ *
+ */
+static void copyConfig(gs1_encoder *dst, const gs1_encoder *src) {
+
+	dst->sym = src->sym;
+	dst->deviceRes = src->deviceRes;
+	dst->minX = src->minX;
+	dst->maxX = src->maxX;
+	dst->targetX = src->targetX;
+	dst->pixMult = src->pixMult;
+	dst->Xundercut = src->Xundercut;
+	dst->Yundercut = src->Yundercut;
+	dst->addCheckDigit = src->addCheckDigit;
+	dst->permitUnknownAIs = src->permitUnknownAIs;
+	dst->validateAIassociations = src->validateAIassociations;
+	dst->aiTable = src->aiTable;		// Borrows any loaded dictionary
+	dst->aiIndex = src->aiIndex;
+	dst->aiTableSize = src->aiTableSize;
+	dst->aiAssoc = src->aiAssoc;
+	dst->aiAssocSize = src->aiAssocSize;
+	dst->sepHt = src->sepHt;
+	dst->dataBarExpandedSegmentsWidth = src->dataBarExpandedSegmentsWidth;
+	dst->gs1_128LinearHeight = src->gs1_128LinearHeight;
+	dst->dmRows = src->dmRows;
+	dst->dmCols = src->dmCols;
+	dst->qrVersion = src->qrVersion;
+	dst->qrEClevel = src->qrEClevel;
+	dst->qrMaskStrategy = src->qrMaskStrategy;
+	dst->qrMask = src->qrMask;
+	dst->format = src->format;
+	dst->fileInputFlag = false;
+	strcpy(dst->outFile, "");
+
+}
+
+
+/*
+ *  Take the next message from the worker's own range, or failing that steal
+ *  the upper half of the range of some other worker. Returns false once all
+ *  of the messages in the batch have been claimed.
+ *
+ */
+static bool claimJob(struct poolWorker *w, size_t *job) {
+
+	gs1_encoder_pool *pool = w->pool;
+	struct poolWorker *v;
+	size_t mid, end;
+	int i;
+
+	pool_mutexLock(&w->lock);
+	if (w->next < w->end) {
+		*job = w->next++;
+		pool_mutexUnlock(&w->lock);
+		return true;
+	}
+	pool_mutexUnlock(&w->lock);
+
+	for (i = 1; i < pool->numWorkers; i++) {
+		v = &pool->workers[(w->id + i) % pool->numWorkers];
+		pool_mutexLock(&v->lock);
+		if (v->next >= v->end) {
+			pool_mutexUnlock(&v->lock);
+			continue;
+		}
+		end = v->end;
+		mid = v->next + (end - v->next) / 2;
+		v->end = mid;
+		pool_mutexUnlock(&v->lock);
+
+		// Only the owner extends its own range, so this cannot race
+		pool_mutexLock(&w->lock);
+		w->next = mid + 1;
+		w->end = end;
+		pool_mutexUnlock(&w->lock);
+
+		*job = mid;
+		return true;
+	}
+
+	return false;
+
+}
+
+
+static bool stageImage(struct poolWorker *w, const uint8_t *buf, const size_t size) {
+
+	uint8_t *p;
+	size_t cap;
+
+	if (size > w->stageCap - w->stageSize) {
+		cap = w->stageCap ? w->stageCap : 4096;
+		while (size > cap - w->stageSize)
+			cap *= 2;
+		if ((p = realloc(w->stage, cap)) == NULL)
+			return false;
+		w->stage = p;
+		w->stageCap = cap;
+	}
+
+	memcpy(w->stage + w->stageSize, buf, size);
+	w->stageSize += size;
+
+	return true;
+
+}
+
+
+static void runWorker(struct poolWorker *w) {
+
+	struct poolBatch *batch = &w->pool->batch;
+	struct poolResult *r;
+	gs1_encoder *ctx = w->ctx;
+	size_t job;
+
+	while (claimJob(w, &job)) {
+
+		r = &batch->results[job];
+		r->worker = w->id;
+		r->offset = w->stageSize;
+		r->size = 0;
+
+		if (!gs1_encoder_setDataStr(ctx, batch->dataStrs[job]) || !gs1_encoder_encode(ctx)) {
+			if (job < w->errIdx) {
+				w->errIdx = job;
+				strcpy(w->errMsg, gs1_encoder_getErrMsg(ctx));
+			}
+			continue;
+		}
+
+		if (!stageImage(w, ctx->buffer, ctx->bufferSize)) {
+			w->allocErr = true;
+			continue;
+		}
+
+		r->size = ctx->bufferSize;
+
+	}
+
+}
+
+
+#if POOL_THREADS
+
+#if defined(_WIN32)
+
+static DWORD WINAPI threadMain(LPVOID arg) {
+	runWorker((struct poolWorker*)arg);
+	return 0;
+}
+
+static bool startThread(struct poolWorker *w) {
+	w->thread = CreateThread(NULL, 0, threadMain, w, 0, NULL);
+	return w->thread != NULL;
+}
+
+static void joinThread(struct poolWorker *w) {
+	WaitForSingleObject(w->thread, INFINITE);
+	CloseHandle(w->thread);
+}
+
+#else
+
+static void* threadMain(void *arg) {
+	runWorker((struct poolWorker*)arg);
+	return NULL;
+}
+
+static bool startThread(struct poolWorker *w) {
+	return pthread_create(&w->thread, NULL, threadMain, w) == 0;
+}
+
+static void joinThread(struct poolWorker *w) {
+	pthread_join(w->thread, NULL);
+}
+
+#endif
+
+#endif  /* POOL_THREADS */
+
+
+GS1_ENCODERS_API gs1_encoder_pool* gs1_encoder_poolInit(int numWorkers) {
+
+	gs1_encoder_pool *pool;
+	struct poolWorker *w;
+	int i;
+
+	if (numWorkers == 0)
+		numWorkers = onlineCPUs();
+	if (numWorkers < 1 || numWorkers > MAX_POOL_WORKERS)
+		return NULL;
+#if !POOL_THREADS
+	numWorkers = 1;
+#endif
+
+	if ((pool = malloc(sizeof(gs1_encoder_pool))) == NULL)
+		return NULL;
+	if ((pool->workers = calloc((size_t)numWorkers, sizeof(struct poolWorker))) == NULL) {
+		free(pool);
+		return NULL;
+	}
+	pool->numWorkers = 0;
+
+	for (i = 0; i < numWorkers; i++) {
+		w = &pool->workers[i];
+		w->pool = pool;
+		w->id = i;
+		if ((w->ctx = gs1_encoder_init(NULL)) == NULL)
+			break;
+		if (!pool_mutexInit(&w->lock)) {
+			gs1_encoder_free(w->ctx);
+			break;
+		}
+		w->ctx->retainBuffer = true;
+		pool->numWorkers++;
+	}
+
+	if (pool->numWorkers != numWorkers) {
+		gs1_encoder_poolFree(pool);
+		return NULL;
+	}
+
+	return pool;
+
+}
+
+
+GS1_ENCODERS_API void gs1_encoder_poolFree(gs1_encoder_pool *pool) {
+
+	struct poolWorker *w;
+	int i;
+
+	if (!pool)
+		return;
+
+	for (i = 0; i < pool->numWorkers; i++) {
+		w = &pool->workers[i];
+		pool_mutexDestroy(&w->lock);
+		w->ctx->retainBuffer = false;
+		gs1_encoder_free(w->ctx);
+		free(w->stage);
+	}
+
+	free(pool->workers);
+	free(pool);
+
+}
+
+
+GS1_ENCODERS_API int gs1_encoder_poolGetNumWorkers(const gs1_encoder_pool *pool) {
+	assert(pool);
+	return pool->numWorkers;
+}
+
+
+GS1_ENCODERS_API size_t gs1_encoder_poolEncodeBatch(gs1_encoder_pool *pool, gs1_encoder *ctx,
+						    const char* const *dataStrs, const size_t num,
+						    void *arena, const size_t max, size_t *offsets, size_t *sizes) {
+
+	struct poolWorker *w;
+	struct poolResult *r;
+	size_t i, used = 0, done = 0, errIdx = SIZE_MAX;
+	const char *errMsg = NULL;
+	bool allocErr = false, full = false;
+	int n;
+
+	assert(pool);
+	assert(ctx);
+	assert(dataStrs || num == 0);
+	assert(arena || max == 0);
+	assert(offsets || num == 0);
+	assert(sizes || num == 0);
+
+	ctx->errFlag = false;
+	ctx->errMsg[0] = '\0';
+	ctx->errCode = gs1_encoder_eNONE;
+
+	if (strcmp(ctx->outFile, "") != 0 || ctx->streamRows) {
+		strcpy(ctx->errMsg, "Batch encoding requires output to a buffer");
+		ctx->errFlag = true;
+		return 0;
+	}
+
+	if (ctx->fileInputFlag) {
+		strcpy(ctx->errMsg, "Batch encoding does not support file input");
+		ctx->errFlag = true;
+		return 0;
+	}
+
+	if (num == 0)
+		return 0;
+
+	if ((pool->batch.results = malloc(num * sizeof(struct poolResult))) == NULL) {
+		strcpy(ctx->errMsg, "Failed to allocate batch results");
+		ctx->errFlag = true;
+		return 0;
+	}
+	pool->batch.dataStrs = dataStrs;
+
+	// Deal out contiguous ranges so that most workers never need to steal
+	for (n = 0; n < pool->numWorkers; n++) {
+		w = &pool->workers[n];
+		copyConfig(w->ctx, ctx);
+		w->next = num * (size_t)n / (size_t)pool->numWorkers;
+		w->end = num * (size_t)(n + 1) / (size_t)pool->numWorkers;
+		w->stageSize = 0;
+		w->errIdx = SIZE_MAX;
+		w->allocErr = false;
+	}
+
+#if POOL_THREADS
+	/*
+	 * The caller's thread acts as the first worker. Should a thread fail to
+	 * start then its range is simply stolen by the others.
+	 *
+	 */
+	{
+		bool started[MAX_POOL_WORKERS];
+		for (n = 1; n < pool->numWorkers; n++)
+			started[n] = startThread(&pool->workers[n]);
+		runWorker(&pool->workers[0]);
+		for (n = 1; n < pool->numWorkers; n++)
+			if (started[n])
+				joinThread(&pool->workers[n]);
+	}
+#else
+	runWorker(&pool->workers[0]);
+#endif
+
+	for (n = 0; n < pool->numWorkers; n++) {
+		w = &pool->workers[n];
+		if (w->errIdx < errIdx) {
+			errIdx = w->errIdx;
+			errMsg = w->errMsg;
+		}
+		allocErr |= w->allocErr;
+	}
+
+	// Collate the staged images into the arena in input order, placing
+	// nothing further once an image does not fit
+	for (i = 0; i < num; i++) {
+		r = &pool->batch.results[i];
+		offsets[i] = used;
+		sizes[i] = 0;
+		if (full || r->size == 0)
+			continue;
+		if (r->size > max - used) {
+			sprintf(ctx->errMsg, "Batch output arena is full at message %d", (int)i);
+			ctx->errFlag = true;
+			full = true;
+			continue;
+		}
+		memcpy((uint8_t*)arena + used, pool->workers[r->worker].stage + r->offset, r->size);
+		sizes[i] = r->size;
+		used += r->size;
+		done++;
+	}
+
+	free(pool->batch.results);
+	pool->batch.results = NULL;
+
+	// Report the earliest message that failed to encode in preference
+	if (errMsg) {
+		snprintf(ctx->errMsg, sizeof(ctx->errMsg), "Message %d: %.480s", (int)errIdx, errMsg);
+		ctx->errFlag = true;
+	} else if (allocErr && !ctx->errFlag) {
+		strcpy(ctx->errMsg, "Failed to allocate batch staging area");
+		ctx->errFlag = true;
+	}
+
+	return done;
+
+}
+
+
+#ifdef UNIT_TESTS
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+
+void test_pool_encodeBatch(void) {
+
+	gs1_encoder_pool *pool;
+	gs1_encoder *ctx;
+	uint8_t arena[65536];
+	size_t offsets[64], sizes[64], serialOffsets[64], serialSizes[64];
+	uint8_t serialArena[65536];
+	const char *dataStrs[64];
+	char msgs[64][40];
+	int i, numWorkers;
+
+	// Alternate small and large symbols so that the workers are unbalanced
+	for (i = 0; i < 64; i++) {
+		if (i % 16 == 0)
+			sprintf(msgs[i], "^0112345678901231^10%018d", i);
+		else
+			sprintf(msgs[i], "^0112345678901231^10X%d", i);
+		dataStrs[i] = msgs[i];
+	}
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+	TEST_CHECK(gs1_encoder_setSym(ctx, gs1_encoder_sQR));
+	TEST_CHECK(gs1_encoder_setFormat(ctx, gs1_encoder_dRAW));
+
+	TEST_ASSERT(gs1_encoder_encodeBatch(ctx, dataStrs, 64, serialArena, sizeof(serialArena), serialOffsets, serialSizes) == 64);
+
+	for (numWorkers = 1; numWorkers <= 8; numWorkers *= 2) {
+
+		TEST_ASSERT((pool = gs1_encoder_poolInit(numWorkers)) != NULL);
+		TEST_CASE_("Workers: %d", numWorkers);
+
+		// Output is identical to that of a serial batch, in input order
+		TEST_CHECK(gs1_encoder_poolEncodeBatch(pool, ctx, dataStrs, 64, arena, sizeof(arena), offsets, sizes) == 64);
+		TEST_MSG("Error: %s", gs1_encoder_getErrMsg(ctx));
+		TEST_CHECK(memcmp(offsets, serialOffsets, sizeof(offsets)) == 0);
+		TEST_CHECK(memcmp(sizes, serialSizes, sizeof(sizes)) == 0);
+		TEST_CHECK(memcmp(arena, serialArena, serialOffsets[63] + serialSizes[63]) == 0);
+
+		// Failed messages are skipped and the earliest is reported
+		dataStrs[40] = "^0112345678901234";
+		dataStrs[10] = "^0112345678901234";
+		TEST_CHECK(gs1_encoder_poolEncodeBatch(pool, ctx, dataStrs, 64, arena, sizeof(arena), offsets, sizes) == 62);
+		TEST_CHECK(sizes[10] == 0 && sizes[40] == 0 && sizes[11] == serialSizes[11]);
+		TEST_CHECK(strncmp(gs1_encoder_getErrMsg(ctx), "Message 10:", 11) == 0);
+		TEST_MSG("Error: %s", gs1_encoder_getErrMsg(ctx));
+		dataStrs[10] = msgs[10];
+		dataStrs[40] = msgs[40];
+
+		// Arena exhaustion
+		TEST_CHECK(gs1_encoder_poolEncodeBatch(pool, ctx, dataStrs, 64, arena, serialOffsets[5], offsets, sizes) == 5);
+		TEST_CHECK(strcmp(gs1_encoder_getErrMsg(ctx), "Batch output arena is full at message 5") == 0);
+
+		// A large image that does not fit stops placement, even where the
+		// small image that follows it would fit in the remaining space
+		TEST_ASSERT(serialSizes[17] < serialSizes[16]);
+		TEST_CHECK(gs1_encoder_poolEncodeBatch(pool, ctx, dataStrs, 64, arena, serialOffsets[16] + serialSizes[17], offsets, sizes) == 16);
+		TEST_CHECK(strcmp(gs1_encoder_getErrMsg(ctx), "Batch output arena is full at message 16") == 0);
+		for (i = 16; i < 64; i++)
+			TEST_CHECK(sizes[i] == 0);
+		TEST_CHECK(memcmp(arena, serialArena, serialOffsets[16]) == 0);
+
+		gs1_encoder_poolFree(pool);
+
+	}
+
+	// Batch requires buffer output
+	TEST_ASSERT((pool = gs1_encoder_poolInit(0)) != NULL);
+	TEST_CHECK(gs1_encoder_poolGetNumWorkers(pool) >= 1);
+	TEST_CHECK(gs1_encoder_setOutFile(ctx, "test.file"));
+	TEST_CHECK(gs1_encoder_poolEncodeBatch(pool, ctx, dataStrs, 64, arena, sizeof(arena), offsets, sizes) == 0);
+	TEST_CHECK(*gs1_encoder_getErrMsg(ctx) != '\0');
+	gs1_encoder_poolFree(pool);
+
+	gs1_encoder_free(ctx);
+
+}
+
+#endif  /* UNIT_TESTS */
@@ -0,0 +1,34 @@
+/**
+ * GS1 Barcode Engine
+ *
+ * @author Copyright (c) 2021 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+#define MAX_POOL_WORKERS	256
+
+
+#ifdef UNIT_TESTS
+
+void test_pool_encodeBatch(void);
+
+#endif
+
+
+#endif  /* POOL_H */
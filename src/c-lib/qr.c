@@ -29,6 +29,7 @@
 #include "debug.h"
 #include "qr.h"
 #include "mtx.h"
+#include "rs.h"
 #include "driver.h"
 
 
@@ -191,49 +192,6 @@ static const uint32_t versionmap[34] = {
 };
 
 
-// Reed Solomon log table in GF(256)
-static const uint8_t rslog[256] = {
-	  0,    // undefined
-	     255,   1,  25,   2,  50,  26, 198,   3, 223,  51, 238,  27, 104, 199,  75,
-	  4, 100, 224,  14,  52, 141, 239, 129,  28, 193, 105, 248, 200,   8,  76, 113,
-	  5, 138, 101,  47, 225,  36,  15,  33,  53, 147, 142, 218, 240,  18, 130,  69,
-	 29, 181, 194, 125, 106,  39, 249, 185, 201, 154,   9, 120,  77, 228, 114, 166,
-	  6, 191, 139,  98, 102, 221,  48, 253, 226, 152,  37, 179,  16, 145,  34, 136,
-	 54, 208, 148, 206, 143, 150, 219, 189, 241, 210,  19,  92, 131,  56,  70,  64,
-	 30,  66, 182, 163, 195,  72, 126, 110, 107,  58,  40,  84, 250, 133, 186,  61,
-	202,  94, 155, 159,  10,  21, 121,  43,  78, 212, 229, 172, 115, 243, 167,  87,
-	  7, 112, 192, 247, 140, 128,  99,  13, 103,  74, 222, 237,  49, 197, 254,  24,
-	227, 165, 153, 119,  38, 184, 180, 124,  17,  68, 146, 217,  35,  32, 137,  46,
-	 55,  63, 209,  91, 149, 188, 207, 205, 144, 135, 151, 178, 220, 252, 190,  97,
-	242,  86, 211, 171,  20,  42,  93, 158, 132,  60,  57,  83,  71, 109,  65, 162,
-	 31,  45,  67, 216, 183, 123, 164, 118, 196,  23,  73, 236, 127,  12, 111, 246,
-	108, 161,  59,  82,  41, 157,  85, 170, 251,  96, 134, 177, 187, 204,  62,  90,
-	203,  89,  95, 176, 156, 169, 160,  81,  11, 245,  22, 235, 122, 117,  44, 215,
-	 79, 174, 213, 233, 230, 231, 173, 232, 116, 214, 244, 234, 168,  80,  88, 175,
-};
-
-
-// Reed Solomon anti-log table in GF(256)
-static const uint8_t rsalog[256] = {
-	  1,   2,   4,   8,  16,  32,  64, 128,  29,  58, 116, 232, 205, 135,  19,  38,
-	 76, 152,  45,  90, 180, 117, 234, 201, 143,   3,   6,  12,  24,  48,  96, 192,
-	157,  39,  78, 156,  37,  74, 148,  53, 106, 212, 181, 119, 238, 193, 159,  35,
-	 70, 140,   5,  10,  20,  40,  80, 160,  93, 186, 105, 210, 185, 111, 222, 161,
-	 95, 190,  97, 194, 153,  47,  94, 188, 101, 202, 137,  15,  30,  60, 120, 240,
-	253, 231, 211, 187, 107, 214, 177, 127, 254, 225, 223, 163,  91, 182, 113, 226,
-	217, 175,  67, 134,  17,  34,  68, 136,  13,  26,  52, 104, 208, 189, 103, 206,
-	129,  31,  62, 124, 248, 237, 199, 147,  59, 118, 236, 197, 151,  51, 102, 204,
-	133,  23,  46,  92, 184, 109, 218, 169,  79, 158,  33,  66, 132,  21,  42,  84,
-	168,  77, 154,  41,  82, 164,  85, 170,  73, 146,  57, 114, 228, 213, 183, 115,
-	230, 209, 191,  99, 198, 145,  63, 126, 252, 229, 215, 179, 123, 246, 241, 255,
-	227, 219, 171,  75, 150,  49,  98, 196, 149,  55, 110, 220, 165,  87, 174,  65,
-	130,  25,  50, 100, 200, 141,   7,  14,  28,  56, 112, 224, 221, 167,  83, 166,
-	 81, 162,  89, 178, 121, 242, 249, 239, 195, 155,  43,  86, 172,  69, 138,   9,
-	 18,  36,  72, 144,  61, 122, 244, 245, 247, 243, 251, 235, 203, 139,  11,  22,
-	 44,  88, 176, 125, 250, 233, 207, 131,  27,  54, 108, 216, 173,  71, 142,   1,
-};
-
-
 // Mask functions
 static inline uint8_t mask1(const uint8_t i, const uint8_t j) {
 	return (uint8_t)((i+j)%2 == 0);
@@ -310,48 +268,6 @@ static void doPutAlign(uint8_t *mtx, uint8_t *fix, const struct metric *m, const
 }
 
 
-// Reed Solomon product in GF(256)
-static inline uint8_t rsProd(const uint8_t a, const uint8_t b) {
-	return a && b ? rsalog[ (rslog[a] + rslog[b]) % 255 ] : 0;
-}
-
-
-// Generate Reed Solomon coefficients using a generator 2
-static void rsGenerateCoeffs(const int size, uint8_t *coeffs) {
-
-	int i, j;
-
-	coeffs[0] = 1;
-	for (i = 0; i < size; i++) {
-		coeffs[i+1] = coeffs[i];
-		for (j = i; j > 0; j--)
-			coeffs[j] = coeffs[j-1] ^ rsProd(coeffs[j], rsalog[i]);
-		coeffs[0] = rsProd(coeffs[0], rsalog[i]);
-	}
-
-}
-
-
-// Perform Reed Solomon ECC codeword calculation
-static void rsEncode(const uint8_t* datcws, const int datlen, uint8_t* ecccws, const int ecclen, const uint8_t* coeffs) {
-
-	int i, j;
-	uint8_t tmp[MAX_QR_DAT_CWS_PER_BLK + MAX_QR_ECC_CWS_PER_BLK] = { 0 };
-
-	assert(datlen <= MAX_QR_DAT_CWS_PER_BLK);
-	assert(ecclen <= MAX_QR_ECC_CWS_PER_BLK);
-
-	memcpy(tmp, datcws, (size_t)datlen);
-
-	for (i = 0; i < datlen; i++)
-		for (j = 0; j < ecclen; j++)
-			tmp[i+j+1] = rsProd(coeffs[ecclen-j-1], tmp[i]) ^ tmp[i+j+1];
-
-	memcpy(ecccws, tmp + datlen, (size_t)ecclen);
-
-}
-
-
 // Plot all of the fixed-position artifacts and reserve space for the format
 // and version information
 static void plotFixtures(uint8_t *mtx, uint8_t *fix, const struct metric *m) {
@@ -456,78 +372,258 @@ static int evaln1n3(const uint8_t *rle) {
 }
 
 
-// Evaluate a mask returning its total score
-static uint32_t evalMask(const uint8_t *mtx, const struct metric *m) {
+#define QR_FAST_MASK_STRIDE	4		// Rows and columns scored by the fast mask strategy
 
-	int i, j, k, p;
-	uint8_t size = m->size;
-	uint8_t pairsa[MAX_QR_SIZE] = { 0 }, pairsb[MAX_QR_SIZE] = { 0 };
-	uint8_t rlec[MAX_QR_SIZE] = { 0 }, rler[MAX_QR_SIZE] = { 0 };
-	uint8_t lastc, lastr, qc, qr;
-	int now, last;
-	int n1n3 = 0, n2 = 0, n4 = 0;
-	uint8_t *lastpairs = &pairsa[0], *thispairs = &pairsb[0], *tmppairs;
+// Unmasked symbol packed into words; the fixtures and mask patterns are held
+// by the version's layout
+struct packedSymbol {
+	uint64_t rows[MAX_QR_SIZE][QR_WORDS];
+	uint64_t cols[MAX_QR_SIZE][QR_WORDS];
+};
+
+static inline int popcnt64(uint64_t v) {
+#if defined(__GNUC__)
+	return __builtin_popcountll(v);
+#else
+	v = v - ((v >> 1) & 0x5555555555555555ULL);
+	v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+	v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (int)((v * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+static inline int ctz64(const uint64_t v) {
+	assert(v);
+#if defined(__GNUC__)
+	return __builtin_ctzll(v);
+#else
+	return popcnt64((v & (~v + 1)) - 1);
+#endif
+}
+
+// Words with bits set for positions below size within word w
+static inline uint64_t wordLimit(const int w, const int size) {
+	const int n = size - w*64;
+	return n >= 64 ? UINT64_MAX : n <= 0 ? 0 : ((uint64_t)1 << n) - 1;
+}
+
+
+/*
+ *  Runlength encode a packed row or column in the form expected by evaln1n3.
+ *
+ *  Transitions are the bits that differ from their predecessor, taking the
+ *  module before the first as light, so that a row starting with a dark module
+ *  generates {0, ...}.
+ *
+ */
+static void rleWords(const uint64_t *v, const int size, uint8_t *rle) {
+
+	uint64_t t, carry = 0;
+	int w, p, last = 0, q = 0;
+
+	for (w = 0; w < QR_WORDS; w++) {
+		t = (v[w] ^ (v[w] << 1 | carry)) & wordLimit(w, size);
+		carry = v[w] >> 63;
+		while (t) {
+			p = w*64 + ctz64(t);
+			rle[q++] = (uint8_t)(p - last);
+			last = p;
+			t &= t - 1;
+		}
+	}
+	rle[q++] = (uint8_t)(size - last);
+	rle[q] = 0;
+
+}
+
+
+// Apply a mask to the non-fixture modules of a packed row or column
+static inline void maskWords(uint64_t *out, const uint64_t *dat, const uint64_t *pat, const uint64_t *free) {
+	int w;
+	for (w = 0; w < QR_WORDS; w++)
+		out[w] = dat[w] ^ (pat[w] & free[w]);
+}
+
+
+/*
+ *  Evaluate a mask returning its total score
+ *
+ *  Only every stride'th row and column is scored, with the run and block
+ *  scores scaled up to match. Every score is non-negative so once the running
+ *  total reaches the bound the mask cannot be better than one already
+ *  evaluated and we give up, returning the bound.
+ *
+ */
+static uint32_t evalMask(const struct packedSymbol *ps, const struct qrLayout *l, const int mask, const int stride, const uint32_t bound, const struct metric *m) {
+
+	int k, w;
+	const int size = m->size;
+	uint8_t rle[MAX_QR_SIZE];
+	uint64_t row[QR_WORDS], col[QR_WORDS], above[QR_WORDS];
+	uint64_t vert, right, vertright;
+	int n1n3 = 0, n2 = 0, n4 = 0, rows = 0;
 
 	assert(size >= 21);  // Satisfy static analyser (div by 0)
+	assert(stride >= 1);
+
+	for (k = 0; k < size; k += stride) {
 
-	for (k = 1; k <= m->size; k++) {
+		maskWords(row, ps->rows[k], l->rowpats[mask][k%QR_MASK_PERIOD], l->freerows[k]);
+		maskWords(col, ps->cols[k], l->colpats[mask][k%QR_MASK_PERIOD], l->freecols[k]);
+
+		// Runlength encode the column and row to score runs and finder-like patterns
+		rleWords(col, size, rle);
+		n1n3 += evaln1n3(rle);
+		rleWords(row, size, rle);
+		n1n3 += evaln1n3(rle);
 
 		/*
-		 *  Runlength encode a column and row to enable efficient
-		 *  calculation of the n1 and n3 scores.
-		 *
-		 *  Generates {0, ...} when starting with dark module
+		 *  Score same coloured blocks: modules that match the module
+		 *  above, and whose right neighbour also matches both the
+		 *  module above it and this module.
 		 *
 		 */
-		qc = lastc = getModule(mtx, k, 1);
-		rlec[0] = lastc ^ 1;
-		rlec[1] = 1;
-		qr = lastr = getModule(mtx, 1, k);
-		rler[0] = lastr ^ 1;
-		rler[1] = 1;
-		for (p = 2; p <= size; p++) {
-			if (getModule(mtx, k, p) == lastc) {
-				rlec[qc]++;
+		if (k > 0) {
+			maskWords(above, ps->rows[k-1], l->rowpats[mask][(k-1)%QR_MASK_PERIOD], l->freerows[k-1]);
+			for (w = 0; w < QR_WORDS; w++) {
+				vert = ~(row[w] ^ above[w]);
+				right = row[w] >> 1;
+				vertright = vert >> 1;
+				if (w + 1 < QR_WORDS) {
+					right |= row[w+1] << 63;
+					vertright |= ~(row[w+1] ^ above[w+1]) << 63;
+				}
+				n2 += 3 * popcnt64(vert & vertright & ~(row[w] ^ right) & wordLimit(w, size - 1));
 			}
-			else {
-				rlec[++qc] = 1;
-				lastc ^= 1;
-			}
-			if (getModule(mtx, p, k) == lastr) {
-				rler[qr]++;
+		}
+
+		// Count dark modules
+		for (w = 0; w < QR_WORDS; w++)
+			n4 += popcnt64(row[w]);
+		rows++;
+
+		if ((uint32_t)((n1n3+n2)*stride) >= bound)
+			return bound;
+
+	}
+
+	n4 = abs(n4*100/(rows*size)-50)/5*10;
+
+	return (uint32_t)((n1n3+n2)*stride+n4);
+}
+
+
+/*
+ *  Pack the rows and columns of a matrix, or its complement, into words
+ *
+ */
+static void packMatrix(const uint8_t *mtx, const bool invert, uint64_t rows[][QR_WORDS], uint64_t cols[][QR_WORDS], const struct metric *m) {
+
+	int i, j;
+	uint64_t bit;
+
+	memset(rows, 0, sizeof(rows[0]) * m->size);
+	memset(cols, 0, sizeof(cols[0]) * m->size);
+
+	for (j = 0; j < m->size; j++) {
+		for (i = 0; i < m->size; i++) {
+			if ((getModule(mtx, i+1, j+1) ^ invert) == 0)
+				continue;
+			bit = (uint64_t)1 << (i%64);
+			rows[j][i/64] |= bit;
+			bit = (uint64_t)1 << (j%64);
+			cols[i][j/64] |= bit;
+		}
+	}
+
+}
+
+
+/*
+ *  Pack the pattern of each mask for rows and columns whose position modulo
+ *  QR_MASK_PERIOD is given
+ *
+ */
+static void packMaskPatterns(uint64_t rowpats[][QR_MASK_PERIOD][QR_WORDS], uint64_t colpats[][QR_MASK_PERIOD][QR_WORDS], const struct metric *m) {
+
+	int k, r, i;
+	uint8_t rowbits[QR_MASK_PERIOD][QR_MASK_PERIOD], colbits[QR_MASK_PERIOD][QR_MASK_PERIOD];
+
+	for (k = 0; k < (int)(SIZEOF_ARRAY(maskfun)); k++) {
+		for (r = 0; r < QR_MASK_PERIOD; r++) {
+			for (i = 0; i < QR_MASK_PERIOD; i++) {
+				rowbits[r][i] = maskfun[k]((uint8_t)i, (uint8_t)r);
+				colbits[r][i] = maskfun[k]((uint8_t)r, (uint8_t)i);
 			}
-			else {
-				rler[++qr] = 1;
-				lastr ^= 1;
+		}
+		memset(rowpats[k], 0, sizeof(rowpats[k]));
+		memset(colpats[k], 0, sizeof(colpats[k]));
+		for (r = 0; r < QR_MASK_PERIOD; r++) {
+			for (i = 0; i < m->size; i++) {
+				rowpats[k][r][i/64] |= (uint64_t)rowbits[r][i%QR_MASK_PERIOD] << (i%64);
+				colpats[k][r][i/64] |= (uint64_t)colbits[r][i%QR_MASK_PERIOD] << (i%64);
 			}
 		}
-		rlec[++qc] = rler[++qr] = 0;
-		n1n3 += evaln1n3(rlec);
-		n1n3 += evaln1n3(rler);
-
-		// Score same coloured blocks
-		tmppairs = lastpairs;
-		lastpairs = thispairs;
-		thispairs = tmppairs;
-		last = getModule(mtx, 1, k) ^ 1;
-		for (i = 1; i <= size; i++) {
-			now = getModule(mtx, i, k);
-			thispairs[i-1] = (uint8_t)(now + last);
-			last = now;
+	}
+
+}
+
+
+/*
+ *  Populate the layout for the symbol's version, unless it is already held.
+ *
+ *  The placement order is found by walking the symbol in the zig-zag manner
+ *  of the specification, avoiding fixed patterns, and recording the bit
+ *  offset within the matrix of each module that is passed.
+ *
+ */
+static void prepareLayout(struct qrLayout *l, const struct metric *m) {
+
+	const int rowbytes = (m->size + 2*QR_QZ - 1)/8 + 1;
+	int i, j, k, x, y, col, dir;
+
+	if (l->version == m->version)
+		return;
+
+	memset(l->img, 0, sizeof(l->img));
+	memset(l->fix, 0, sizeof(l->fix));
+	plotFixtures(l->img, l->fix, m);
+
+	i = j = m->size;
+	dir = -1;   // -1 updates; 1 downwards
+	col = 1;    // 0 is left bit; 1 is right bit
+	for (k = 0; i >= 1; )
+	{
+		if (!getModule(l->fix, i, j)) {
+			assert(k < MAX_QR_MODULES);
+			x = i + QR_QZ - 1;
+			y = j + QR_QZ - 1;
+			l->place[k++] = (uint16_t)((rowbytes*y + x/8) * 8 + x%8);
+		}
+		if (col == 1) {
+			col = 0;
+			i--;
+			continue;
 		}
-		if (k > 1)
-			for (i = size-1; i>=0; i--)
-				if (((thispairs[i] + lastpairs[i]) & 3) == 0)
-					n2 += 3;
+		col = 1;
+		i++;
+		j += dir;
+		if (j >= 1 && j <= m->size)
+			continue;
+		// Turn around at top and bottom
+		dir *= -1;
+		i -= 2;
+		j += dir;
+		if (i == 7)  // Hop over the timing pattern
+			i--;
 	}
+	assert(k == m->modules);  // Filled the symbol
+
+	packMatrix(l->fix, true, l->freerows, l->freecols, m);
+	packMaskPatterns(l->rowpats, l->colpats, m);
 
-	// Score dark/light balance
-	for (i = 1; i <= size; i++)
-		for (j = 1; j <= size; j++)
-			n4 += getModule(mtx, i, j) == 1;
-	n4 = abs(n4*100/(size*size)-50)/5*10;
+	l->version = m->version;
 
-	return (uint32_t)(n1n3+n2+n4);
 }
 
 
@@ -565,12 +661,191 @@ static void addBits(uint8_t bitField[], uint16_t* bitPos, int length, uint16_t b
 }
 
 
+/*
+ *  Encodation modes, in the order of cclens
+ *
+ */
+enum {
+	MODE_N = 0,
+	MODE_A,
+	MODE_B,
+	NUM_MODES,		// Kanji mode is not used
+};
+
+static const uint8_t modeIndicator[NUM_MODES] = { 0x01, 0x02, 0x04 };
+
+#define COST_INF UINT32_MAX
+
+
+// Alphanumeric mode value of each character, see isAlnum()
+static const int8_t alnumVal[128] = {
+	['0'] =  0, ['1'] =  1, ['2'] =  2, ['3'] =  3, ['4'] =  4, ['5'] =  5, ['6'] =  6, ['7'] =  7,
+	['8'] =  8, ['9'] =  9, ['A'] = 10, ['B'] = 11, ['C'] = 12, ['D'] = 13, ['E'] = 14, ['F'] = 15,
+	['G'] = 16, ['H'] = 17, ['I'] = 18, ['J'] = 19, ['K'] = 20, ['L'] = 21, ['M'] = 22, ['N'] = 23,
+	['O'] = 24, ['P'] = 25, ['Q'] = 26, ['R'] = 27, ['S'] = 28, ['T'] = 29, ['U'] = 30, ['V'] = 31,
+	['W'] = 32, ['X'] = 33, ['Y'] = 34, ['Z'] = 35, [' '] = 36, ['$'] = 37, ['%'] = 38, ['*'] = 39,
+	['+'] = 40, ['-'] = 41, ['.'] = 42, ['/'] = 43, [':'] = 44,
+};
+
+static inline bool isAlnum(const uint8_t c) {
+	return c == '0' || (c < 128 && alnumVal[c] != 0);
+}
+
+
+/*
+ *  Cost of a character in each mode, in sixths of a bit, or COST_INF when
+ *  the mode cannot encode it
+ *
+ *  In GS1 mode FNC1 ("^") is "%" in alphanumeric mode, so a data "%" must be
+ *  escaped as "%%", and is GS in byte mode. An FNC1 that is followed by FNC1 or
+ *  "%" would read back as a data "%" so it is left to byte mode.
+ *
+ */
+static void charCosts(const uint8_t *s, const bool gs1Mode, uint32_t costs[NUM_MODES]) {
+
+	const uint8_t c = *s;
+
+	costs[MODE_N] = c >= '0' && c <= '9' ? 20 : COST_INF;	// 10 bits per 3 digits
+	costs[MODE_A] = isAlnum(c) ? 33 : COST_INF;		// 11 bits per 2 characters
+	if (c == '^' && gs1Mode)
+		costs[MODE_A] = s[1] != '^' && s[1] != '%' ? 33 : COST_INF;
+	if (c == '%' && gs1Mode)
+		costs[MODE_A] = 66;
+	costs[MODE_B] = 48;
+
+}
+
+
+/*
+ *  Choose the mode of each character that gives the shortest bitstream for
+ *  the character count lengths of the given vergrp
+ *
+ *  This is a shortest path over the characters in which the state is the mode
+ *  of the next character. Costs are in sixths of a bit, rounded up to a whole
+ *  bit when a segment ends, which is then exact for each mode. For each
+ *  character and each following mode we record the mode of the character, two
+ *  bits apiece, and trace these back from the cheapest final state.
+ *
+ */
+static void segmentModes(const uint8_t *str, const size_t len, const bool gs1Mode, const int vergrp, uint8_t *modes) {
+
+	uint32_t head[NUM_MODES], costs[NUM_MODES], prev[NUM_MODES], cur[NUM_MODES], ended[NUM_MODES], sw;
+	size_t k;
+	int m, j, mode;
+
+	for (m = 0; m < NUM_MODES; m++) {
+		head[m] = (uint32_t)(4 + cclens[vergrp][m]) * 6;	// Mode indicator and character count
+		prev[m] = head[m];
+	}
+
+	for (k = 0; k < len; k++) {
+
+		charCosts(&str[k], gs1Mode, costs);
+
+		modes[k] = 0;
+		for (m = 0; m < NUM_MODES; m++) {
+			cur[m] = prev[m] == COST_INF || costs[m] == COST_INF ? COST_INF : prev[m] + costs[m];
+			modes[k] = (uint8_t)(modes[k] | m << (2*m));
+			ended[m] = cur[m] == COST_INF ? COST_INF : (cur[m] + 5) / 6 * 6;
+		}
+
+		// End the segment after this character and start another
+		for (m = 0; m < NUM_MODES; m++) {
+			for (j = 0; j < NUM_MODES; j++) {
+				if (j == m || ended[j] == COST_INF)
+					continue;
+				sw = ended[j] + head[m];
+				if (sw < cur[m]) {
+					cur[m] = sw;
+					modes[k] = (uint8_t)((modes[k] & ~(3 << (2*m))) | j << (2*m));
+				}
+			}
+		}
+
+		memcpy(prev, cur, sizeof(prev));
+
+	}
+
+	mode = MODE_B;
+	for (m = 0; m < NUM_MODES; m++)
+		if (prev[m] != COST_INF && (prev[m] + 5) / 6 < (prev[mode] + 5) / 6)
+			mode = m;
+
+	for (k = len; k-- > 0;) {
+		mode = modes[k] >> (2*mode) & 3;
+		modes[k] = (uint8_t)mode;
+	}
+
+}
+
+
+// Append a segment of characters that are all in the given mode
+static void addSegment(uint8_t *cws, uint16_t *bits, const uint8_t *str, const size_t len, const int mode, const bool gs1Mode, const int vergrp) {
+
+	size_t i, count;
+	uint16_t val = 0;
+	bool pend = false;
+	int n;
+	uint8_t c;
+
+	count = len;
+	if (mode == MODE_A && gs1Mode)
+		for (i = 0; i < len; i++)
+			if (str[i] == '%')
+				count++;			// Escaped as "%%"
+
+	if (count >= 1u << cclens[vergrp][mode]) {
+		*bits = UINT16_MAX;			// Count indicator overflows, so too big for this vergrp
+		return;
+	}
+
+	addBits(cws, bits, 4, modeIndicator[mode], MAX_QR_DAT_BITS, false);
+	addBits(cws, bits, cclens[vergrp][mode], (uint16_t)count, MAX_QR_DAT_BITS, false);
+
+	switch (mode) {
+
+	case MODE_N:
+		for (i = 0; i + 3 <= len; i += 3)
+			addBits(cws, bits, 10, (uint16_t)((str[i]-'0')*100 + (str[i+1]-'0')*10 + (str[i+2]-'0')), MAX_QR_DAT_BITS, false);
+		if (len - i == 2)
+			addBits(cws, bits, 7, (uint16_t)((str[i]-'0')*10 + (str[i+1]-'0')), MAX_QR_DAT_BITS, false);
+		else if (len - i == 1)
+			addBits(cws, bits, 4, (uint16_t)(str[i]-'0'), MAX_QR_DAT_BITS, false);
+		break;
+
+	case MODE_A:
+		for (i = 0; i < len; i++) {
+			c = str[i] == '^' && gs1Mode ? '%' : str[i];	// FNC1 -> "%"
+			for (n = str[i] == '%' && gs1Mode ? 2 : 1; n > 0; n--) {	// Data "%" -> "%%"
+				if (pend)
+					addBits(cws, bits, 11, (uint16_t)(val*45 + alnumVal[c]), MAX_QR_DAT_BITS, false);
+				else
+					val = (uint16_t)alnumVal[c];
+				pend = !pend;
+			}
+		}
+		if (pend)
+			addBits(cws, bits, 6, val, MAX_QR_DAT_BITS, false);
+		break;
+
+	default:
+		for (i = 0; i < len; i++)
+			addBits(cws, bits, 8, str[i] == '^' && gs1Mode ? 0x1d : str[i], MAX_QR_DAT_BITS, false);  // FNC1 -> GS
+		break;
+
+	}
+
+}
+
+
 // Generate the bitstream that represents the data message as a sequence of 8-bit codewords and length
 static void createCodewords(gs1_encoder *ctx, const uint8_t *str, uint8_t cws_v[3][MAX_QR_CWS], uint16_t bits_v[3]) {
 
 	int i;
 	bool gs1Mode = false;
 	const uint8_t *p;
+	size_t len, k, run;
+	uint8_t modes[MAX_DATA];
 
 	(void) ctx;		// Silence compiler
 
@@ -586,6 +861,9 @@ static void createCodewords(gs1_encoder *ctx, const uint8_t *str, uint8_t cws_v[
 			str++;
 	}
 
+	len = strlen((const char*)str);
+	assert(len <= MAX_DATA);
+
 	/*
 	 * Elements of the encoded message have differing lengths based on the
 	 * resulting symbol size. The symbol sizes with different element
@@ -593,29 +871,21 @@ static void createCodewords(gs1_encoder *ctx, const uint8_t *str, uint8_t cws_v[
 	 * that holds our content we encode the message according to each
 	 * available vergrp, based on the format of symbol.
 	 *
+	 * Within each vergrp the message is divided into segments of numeric,
+	 * alphanumeric and byte mode data so that the bitstream is shortest.
+	 *
 	 */
 	for (i = 0; i < 3; i++) {
 
-		p = str;
-
 		// 0101 FNC1 in first
 		if (gs1Mode)
 			addBits(cws_v[i], &bits_v[i], 4, 0x05, MAX_QR_DAT_BITS, false);
 
-		// 0100 Enter byte mode
-		addBits(cws_v[i], &bits_v[i], 4, 0x04, MAX_QR_DAT_BITS, false);
-
-		// Character count indicator
-		addBits(cws_v[i], &bits_v[i], cclens[i][2],
-			(uint16_t)strlen((char *)p), MAX_QR_DAT_BITS, false);
+		segmentModes(str, len, gs1Mode, i, modes);
 
-		// Byte per character
-		while (*p) {
-			if (*p == '^' && gs1Mode)
-				addBits(cws_v[i], &bits_v[i], 8, 0x1d, MAX_QR_DAT_BITS, false);  // FNC1 -> GS
-			else
-				addBits(cws_v[i], &bits_v[i], 8, *p, MAX_QR_DAT_BITS, false);
-			p++;
+		for (k = 0; k < len && bits_v[i] != UINT16_MAX; k += run) {
+			for (run = 1; k + run < len && modes[k + run] == modes[k]; run++);
+			addSegment(cws_v[i], &bits_v[i], str + k, run, modes[k], gs1Mode, i);
 		}
 
 	}
@@ -657,7 +927,7 @@ static void finaliseCodewords(gs1_encoder *ctx, uint8_t *cws, uint16_t *bits, co
 
 	uint8_t tmpcws[MAX_QR_CWS];
 
-	uint8_t coeffs[MAX_QR_ECC_CWS_PER_BLK+1];
+	struct gs1_rsCode *rs = ctx->rs_code;
 
 	int ncws, rbit, ecws, dcws, dmod, ecb1, ecb2, dcpb, ecpb;
 
@@ -679,6 +949,7 @@ static void finaliseCodewords(gs1_encoder *ctx, uint8_t *cws, uint16_t *bits, co
 
 	assert(dcpb <= MAX_QR_DAT_CWS_PER_BLK);
 	assert(ecpb <= MAX_QR_ECC_CWS_PER_BLK);
+	assert(ecpb <= MAX_RS_ECC_CWS);
 
 	// Complete the message bits by adding the terminator, truncated if neccessary
 	addBits(cws, bits, 4, 0x00, dmod, true);  // 0000, or shorter at end
@@ -690,16 +961,18 @@ static void finaliseCodewords(gs1_encoder *ctx, uint8_t *cws, uint16_t *bits, co
 	}
 	assert(*bits == dmod);
 
-	// Generate coefficients
-	rsGenerateCoeffs(ecpb, coeffs);
+	// Prepare the generator once for every block, unless retained from an
+	// earlier symbol
+	assert(rs);
+	gs1_rsPrepareCode(rs, gs1_rsFieldQR, ecpb);
 
 	// Calculate the error correction codewords in two groups of blocks
 	memcpy(tmpcws, cws, (size_t)dcws);
 	for (i = 0; i < ecb1; i++)
-		rsEncode(cws + i*dcpb, dcpb, tmpcws + dcws + i*ecpb, ecpb, coeffs);
+		gs1_rsEncode(rs, cws + i*dcpb, dcpb, tmpcws + dcws + i*ecpb);
 	for (i = 0; i < ecb2; i++)
-		rsEncode(cws + ecb1*dcpb + i*(dcpb+1), dcpb + 1,
-			 tmpcws + dcws + (i+ecb1)*ecpb, ecpb, coeffs);
+		gs1_rsEncode(rs, cws + ecb1*dcpb + i*(dcpb+1), dcpb + 1,
+			     tmpcws + dcws + (i+ecb1)*ecpb);
 
 	// Reassemble the codewords by interleaving the data and ECC blocks
 	p = cws;
@@ -726,58 +999,51 @@ static void finaliseCodewords(gs1_encoder *ctx, uint8_t *cws, uint16_t *bits, co
 // Create a symbol that holds the given bitstream
 static void createMatrix(gs1_encoder *ctx, uint8_t *mtx, const uint8_t *cws, const struct metric *m) {
 
-	uint8_t fix[MAX_QR_BYTES] = { 0 };	// Matrix in which 1 indicates fixed pattern
-	uint8_t msk[MAX_QR_BYTES];		// Matrix used for mask evaluation
+	struct qrLayout *l = ctx->qr_layout;	// Fixtures and placement order for the version
+
+	struct packedSymbol ps;			// Symbol packed for mask evaluation
 
 	uint8_t mask = 0;			// Satisfy compiler
 	uint32_t formatval, versionval;
 	uint32_t bestScore = UINT32_MAX, score;
 
-	int i, j, k, col, dir;
+	int i, k, stride;
+
+	assert(l);
 
 	// Plot fixtures, including reservation of format and version
 	// information
-	plotFixtures(mtx, fix, m);
+	prepareLayout(l, m);
+	memcpy(mtx, l->img, (size_t)(((m->size + 2*QR_QZ - 1)/8 + 1) * (m->size + 2*QR_QZ)));
 
-	// Walk the symbol placing the bitstream avoiding fixed patterns
-	i = j = m->size;
-	dir = -1;   // -1 updates; 1 downwards
-	col = 1;    // 0 is left bit; 1 is right bit
-	for (k = 0; i >= 1; )
-	{
-		if (!getModule(fix, i, j)) {
-			putModule(mtx, i, j, (uint8_t)((cws[k/8] >> (7-k%8)) & 1));
-			k++;
-		}
-		if (col == 1) {
-			col = 0;
-			i--;
-			continue;
-		}
-		col = 1;
-		i++;
-		j += dir;
-		if (j >= 1 && j <= m->size)
-			continue;
-		// Turn around at top and bottom
-		dir *= -1;
-		i -= 2;
-		j += dir;
-		if (i == 7)  // Hop over the timing pattern
-			i--;
-	}
-	assert(k == m->modules);  // Filled the symbol
+	// Scatter the bitstream into the data modules in placement order
+	for (k = 0; k < m->modules; k++)
+		mtx[l->place[k] >> 3] |= (uint8_t)(((cws[k/8] >> (7-k%8)) & 1) << (7 - (l->place[k] & 7)));
 
-	// Evaluate the masked symbols to find the most suitable
-	for (k = 0; k < (int)(SIZEOF_ARRAY(maskfun)); k++) {
-		applyMask(msk, mtx, maskfun[k], fix, m);
-		score = evalMask(msk, m);
-		if (score < bestScore) {
-			mask = (uint8_t)k;
-			bestScore = score;
+	/*
+	 *  Evaluate the masked symbols to find the most suitable.
+	 *
+	 *  The symbol is packed into words, by row and by column, so that
+	 *  masking a row with the layout's non-fixture modules and mask
+	 *  patterns is an AND and XOR per word.
+	 *
+	 *  The fast strategy scores a sample of the rows and columns.
+	 *
+	 */
+	if (ctx->qrMaskStrategy == gs1_encoder_qrMaskFixed) {
+		mask = (uint8_t)ctx->qrMask;
+	} else {
+		packMatrix(mtx, false, ps.rows, ps.cols, m);
+		stride = ctx->qrMaskStrategy == gs1_encoder_qrMaskFast ? QR_FAST_MASK_STRIDE : 1;
+		for (k = 0; k < (int)(SIZEOF_ARRAY(maskfun)); k++) {
+			score = evalMask(&ps, l, k, stride, bestScore, m);
+			if (score < bestScore) {
+				mask = (uint8_t)k;
+				bestScore = score;
+			}
 		}
 	}
-	applyMask(mtx, mtx, maskfun[mask], fix, m);
+	applyMask(mtx, mtx, maskfun[mask], l->fix, m);
 
 	// Set the solitary dark module
 	putModule(mtx, 9, -8, 1);
@@ -809,9 +1075,8 @@ static void createMatrix(gs1_encoder *ctx, uint8_t *mtx, const uint8_t *cws, con
 }
 
 
-static int QRenc(gs1_encoder *ctx, const uint8_t string[], struct patternLength *pats) {
+static int QRenc(gs1_encoder *ctx, const uint8_t string[], uint8_t mtx[]) {
 
-	uint8_t mtx[MAX_QR_BYTES] = { 0 };
 	uint8_t cws_v[3][MAX_QR_CWS] = { 0 };	// vergrp specific encodings
 	uint16_t bits_v[3] = { 0 };
 	const struct metric *m;
@@ -879,10 +1144,6 @@ static int QRenc(gs1_encoder *ctx, const uint8_t string[], struct patternLength
 
 	DEBUG_PRINT_MATRIX("Matrix", mtx, m->size + 2*QR_QZ, m->size + 2*QR_QZ);
 
-	gs1_mtxToPatterns(mtx, m->size + 2*QR_QZ, m->size + 2*QR_QZ, pats);
-
-	DEBUG_PRINT_PATTERN_LENGTHS("Patterns", pats, m->size + 2*QR_QZ);
-
 	return m->size + 2*QR_QZ;
 
 }
@@ -892,17 +1153,25 @@ void gs1_QR(gs1_encoder *ctx) {
 
 	struct sPrints prints = { 0 };
 	struct patternLength *pats;
+	uint8_t mtx[MAX_QR_BYTES] = { 0 };
 	char* dataStr = ctx->dataStr;
 	int rows, cols, i;
 
-	pats = ctx->qr_pats;
+	if (!(rows = QRenc(ctx, (uint8_t*)dataStr, mtx)) || ctx->errFlag)
+		goto out;
+
+	cols = rows;
 
-	if (!(rows = QRenc(ctx, (uint8_t*)dataStr, pats)) || ctx->errFlag)
+	if (ctx->moduleMode) {
+		gs1_driverMatrix(ctx, mtx, cols, rows);
 		goto out;
+	}
+
+	pats = ctx->qr_pats;
 
-	cols = 0;
-	for (i = 0; i < pats[0].length; i++)
-		cols += pats[0].pattern[i];
+	gs1_mtxToPatterns(mtx, cols, rows, pats);
+
+	DEBUG_PRINT_PATTERN_LENGTHS("Patterns", pats, rows);
 
 	gs1_driverInit(ctx, (long)ctx->pixMult*cols, (long)ctx->pixMult*rows);
 
@@ -944,6 +1213,7 @@ void test_qr_QR_fixtures(void) {
 	uint8_t mtx[MAX_QR_BYTES];
 	uint8_t fix[MAX_QR_BYTES];
 	char casename[4];
+	static struct qrLayout l;
 
 	// Check that the modules available after plotting the fixtures matches
 	// the values provided by the specification
@@ -961,6 +1231,141 @@ void test_qr_QR_fixtures(void) {
 		TEST_MSG("Expected %d; Got %d", m->modules, cnt);
 	}
 
+	// Check that the placement order of each layout visits every
+	// non-fixture module exactly once, starting at the bottom-right
+	l.version = 0;
+	for (v = 1; v <= 40; v++) {
+		m = &(metrics[v]);
+		prepareLayout(&l, m);
+		memcpy(fix, l.fix, MAX_QR_BYTES);
+		for (i = 0, cnt = 0; i < m->modules; i++) {
+			cnt += (fix[l.place[i] >> 3] >> (7 - (l.place[i] & 7))) & 1;
+			fix[l.place[i] >> 3] |= (uint8_t)(0x80 >> (l.place[i] & 7));
+		}
+		for (i = 1; i <= m->size; i++)
+			for (j = 1; j <= m->size; j++)
+				cnt += getModule(fix, i, j) ^ 1;
+		sprintf(casename, "V%d", v);
+		TEST_CASE(casename);
+		TEST_CHECK(cnt == 0);
+		TEST_CHECK(l.version == v);
+		TEST_CHECK(l.place[0] == ((m->size + 2*QR_QZ - 1)/8 + 1) * (m->size + QR_QZ - 1) * 8 + m->size + QR_QZ - 1);
+	}
+
+}
+
+
+void test_qr_QR_rleWords(void) {
+
+	uint64_t v[QR_WORDS];
+	uint8_t rle[MAX_QR_SIZE];
+
+	// Light start, runs crossing each word boundary
+	v[0] = 0xF000000000000000ULL;		// Dark 60-63
+	v[1] = 0x0000000000000003ULL;		// Dark 64-65
+	v[2] = 0;
+	rleWords(v, 177, rle);
+	TEST_CHECK(rle[0] == 60 && rle[1] == 6 && rle[2] == 111 && rle[3] == 0);
+
+	// Dark start and end
+	v[0] = 0x0000000000000001ULL;		// Dark 0
+	v[1] = 0;
+	v[2] = 0x0001000000000000ULL;		// Dark 176
+	rleWords(v, 177, rle);
+	TEST_CHECK(rle[0] == 0 && rle[1] == 1 && rle[2] == 175 && rle[3] == 1 && rle[4] == 0);
+
+	// All light
+	v[0] = v[1] = v[2] = 0;
+	rleWords(v, 21, rle);
+	TEST_CHECK(rle[0] == 21 && rle[1] == 0);
+
+}
+
+
+static bool test_segments(gs1_encoder *ctx, const char *str, const uint16_t b0, const uint16_t b1, const uint16_t b2) {
+
+	uint8_t cws_v[3][MAX_QR_CWS] = { { 0 } };
+	uint16_t bits_v[3] = { 0 };
+
+	createCodewords(ctx, (const uint8_t*)str, cws_v, bits_v);
+
+	TEST_MSG("Expected %d %d %d; Got %d %d %d", b0, b1, b2, bits_v[0], bits_v[1], bits_v[2]);
+
+	return bits_v[0] == b0 && bits_v[1] == b1 && bits_v[2] == b2;
+
+}
+
+
+void test_qr_QR_segments(void) {
+
+	gs1_encoder* ctx = gs1_encoder_init(NULL);
+
+	// Message length for each vergrp
+	TEST_CHECK(test_segments(ctx, "^0112345678901231", 72, 74, 76));			// N
+	TEST_CHECK(test_segments(ctx, "^2112345678901234567890", 92, 94, 96));			// N
+	TEST_CHECK(test_segments(ctx, "^011234567890123110ABC123^11210630", 171, 177, 182));	// N A N, FNC1 as "%"
+	TEST_CHECK(test_segments(ctx, "^99A%B", 50, 52, 54));					// A, with "%" as "%%"
+	TEST_CHECK(test_segments(ctx, "https://id.gs1.org/01/12312312312333", 249, 259, 261));	// B N
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+// Copy of the RAW buffer of a QR Code encoded with the given mask strategy
+static size_t test_maskedBuffer(gs1_encoder *ctx, const int strategy, const int mask, uint8_t *out) {
+
+	void *buf;
+	size_t size;
+
+	TEST_CHECK(gs1_encoder_setQrMaskStrategy(ctx, strategy));
+	TEST_CHECK(gs1_encoder_setQrMask(ctx, mask));
+	TEST_ASSERT(gs1_encoder_encode(ctx));
+	size = gs1_encoder_getBuffer(ctx, &buf);
+	TEST_ASSERT(size > 0 && size <= MAX_QR_BYTES);
+	memcpy(out, buf, size);
+
+	return size;
+
+}
+
+
+void test_qr_QR_maskStrategy(void) {
+
+	int k, j, best = -1, fast = -1;
+	size_t size;
+	uint8_t fixed[8][MAX_QR_BYTES], buf[MAX_QR_BYTES];
+
+	gs1_encoder* ctx = gs1_encoder_init(NULL);
+
+	TEST_ASSERT(gs1_encoder_setFormat(ctx, gs1_encoder_dRAW));
+	TEST_ASSERT(gs1_encoder_setSym(ctx, gs1_encoder_sQR));
+	TEST_ASSERT(gs1_encoder_setQrVersion(ctx, gs1_encoder_qrVersion12));
+	TEST_ASSERT(gs1_encoder_setDataStr(ctx, "^011231231231233310ABC123^99TESTING"));
+
+	// Each fixed mask gives a different symbol
+	size = test_maskedBuffer(ctx, gs1_encoder_qrMaskFixed, 0, fixed[0]);
+	for (k = 1; k < 8; k++) {
+		TEST_CHECK(test_maskedBuffer(ctx, gs1_encoder_qrMaskFixed, k, fixed[k]) == size);
+		for (j = 0; j < k; j++)
+			TEST_CHECK(memcmp(fixed[j], fixed[k], size) != 0);
+	}
+
+	// Evaluation and the fast strategy each pick one of them
+	test_maskedBuffer(ctx, gs1_encoder_qrMaskEvaluate, 0, buf);
+	for (k = 0; k < 8; k++)
+		if (memcmp(fixed[k], buf, size) == 0)
+			best = k;
+	TEST_CHECK(best != -1);
+
+	test_maskedBuffer(ctx, gs1_encoder_qrMaskFast, 0, buf);
+	for (k = 0; k < 8; k++)
+		if (memcmp(fixed[k], buf, size) == 0)
+			fast = k;
+	TEST_CHECK(fast != -1);
+
+	gs1_encoder_free(ctx);
+
 }
 
 
@@ -1000,35 +1405,35 @@ void test_qr_QR_encode(void) {
 "                                     ",
 "                                     ",
 "                                     ",
-"    XXXXXXX X  XXX X   X  XXXXXXX    ",
-"    X     X X X XX  XX    X     X    ",
-"    X XXX X        XX X X X XXX X    ",
-"    X XXX X X X   XXXXXX  X XXX X    ",
-"    X XXX X   XXX XX XXXX X XXX X    ",
-"    X     X   X  X   X XX X     X    ",
+"    XXXXXXX   XXX  X    X XXXXXXX    ",
+"    X     X X   X X  X XX X     X    ",
+"    X XXX X  XX X X X XX  X XXX X    ",
+"    X XXX X   X XX        X XXX X    ",
+"    X XXX X X X XXX XX XX X XXX X    ",
+"    X     X   X  X X X XX X     X    ",
 "    XXXXXXX X X X X X X X XXXXXXX    ",
-"            X   X  X X  X            ",
-"    X XX XXX  X  X   X XX X  X XX    ",
-"    X   XX  X XXXXX    X  XXX   X    ",
-"        X X   XX X  X   X   X XX     ",
-"     X X    XXXXX  XX XX X X    X    ",
-"         XX    X  XXXXX XX   XX      ",
-"    XX  XX XX X X XX XXXXXX   XXX    ",
-"    X XXXXXX    XX  X  XX X X XXX    ",
-"     X XXX XX X   X    XX  X   X     ",
-"    X     XX XXXX X X  XX  XXX X     ",
-"      XXXX XXX XX XXX X      XXX     ",
-"    X X  XXX     XXXXXX X X X X      ",
-"       X    XX   XX  X X  X   X      ",
-"     X XX XXX X  XX  X XXXXXXXX      ",
-"            XX XX       X   XXXXX    ",
-"    XXXXXXX XXX   X X  XX X XX X     ",
-"    X     X X  X XXXX X X   XX  X    ",
-"    X XXX X   XXX  XXXX XXXXX X      ",
-"    X XXX X XX  X  X XX  X XXX  X    ",
-"    X XXX X X XX X  X  X   X  X X    ",
-"    X     X  X XX X    XX XXXX X     ",
-"    XXXXXXX XXXX X  X  XXXXXX  X     ",
+"              XX    XX X             ",
+"    X X X X   XXXX   X      X  X     ",
+"    X X X     X  XX X X   X  X  X    ",
+"    X XX  XXXX XXX XXXX X XX  XXX    ",
+"      XX       XXX X XXX  X    X     ",
+"         XX X     XXX X   X  X XX    ",
+"    XXXX    X X    X  X   X  X  X    ",
+"    X   XXX    XX X XX    X  X XX    ",
+"    XX X   XX  X    X   X   XX X     ",
+"        X X  X  XX     XX X  X XX    ",
+"        X     X XXX XX   XXX XX X    ",
+"    X  X  XX X XXX XXX   X  X  XX    ",
+"     XXXX  XXX XXX X  X XXX  X X     ",
+"    X  X XX  X  X XXXXX XXXXX        ",
+"            X XXX  X XXXX   X XXX    ",
+"    XXXXXXX  XXX  X X XXX X XX XX    ",
+"    X     X  XXX    X X X   XX XX    ",
+"    X XXX X X   X    X  XXXXX  XX    ",
+"    X XXX X   XXX   X  XX  XX X      ",
+"    X XXX X XX X XX X   X  XXX  X    ",
+"    X     X     X XX XX X X    X     ",
+"    XXXXXXX XXX  X XX XXXX     XX    ",
 "                                     ",
 "                                     ",
 "                                     ",
@@ -1038,43 +1443,39 @@ NULL
 	TEST_CHECK(test_encode(ctx, true, gs1_encoder_sQR, "https://id.gs1.org/01/12312312312333", expect));
 
 	expect = (const char*[]){
-"                                     ",
-"                                     ",
-"                                     ",
-"                                     ",
-"    XXXXXXX     XX  X     XXXXXXX    ",
-"    X     X  X XX X XXX X X     X    ",
-"    X XXX X XX  X  X   X  X XXX X    ",
-"    X XXX X XXXXX  XXXX X X XXX X    ",
-"    X XXX X X     XX  XX  X XXX X    ",
-"    X     X X X    X XX   X     X    ",
-"    XXXXXXX X X X X X X X XXXXXXX    ",
-"            XXXX XXXX   X            ",
-"    X XXXXX  XXXXXX  XX   XXXXX      ",
-"      X X  X  X XX  X  X X  X        ",
-"      XX XX XX X  X   X  X X XXX     ",
-"    X X  X X X     X X  X X X   X    ",
-"      XXX XX XXXX  X    XX XX XX     ",
-"     X X X   XX X XX                 ",
-"     XXX XX  X XX  XXXX  X X XXX     ",
-"        XX   XX  XX     X X X   X    ",
-"     XX X X X X XXXXX X  X  XXXX     ",
-"    X       X XXXX       XX    X     ",
-"    X X  XXXX  X  XXXXX XX X XXX     ",
-"    X XXX  X  X        X  X XX  X    ",
-"    X  XXXXXX XX   X  X XXXXX  X     ",
-"            XX XX X X  XX   X        ",
-"    XXXXXXX  XXXX  XXXX X X XXXX     ",
-"    X     X X   XXX     X   XX XX    ",
-"    X XXX X XXXXX XX XX XXXXXX X     ",
-"    X XXX X X   XX X  XXXX X   X     ",
-"    X XXX X X XXX XXXXX   XXXXX      ",
-"    X     X   X X X    X X X X       ",
-"    XXXXXXX XX     XX X   X X X      ",
-"                                     ",
-"                                     ",
-"                                     ",
-"                                     ",
+"                                 ",
+"                                 ",
+"                                 ",
+"                                 ",
+"    XXXXXXX X      XX XXXXXXX    ",
+"    X     X X X   XXX X     X    ",
+"    X XXX X  X X X  X X XXX X    ",
+"    X XXX X X  XXXXX  X XXX X    ",
+"    X XXX X   X XXX   X XXX X    ",
+"    X     X  XXX   XX X     X    ",
+"    XXXXXXX X X X X X XXXXXXX    ",
+"            X X   X              ",
+"    X XX XXX X XX   X X  X XX    ",
+"    X    X X X   XXXX X  XXX     ",
+"     X XX XX XX X     X X XX     ",
+"     X X   XXXX XX  X XXX  XX    ",
+"    X X   XX  X X   XXX  XX      ",
+"           XXX   X    X    X     ",
+"     XXXXXX  X   XXX    XX       ",
+"    X X XX XXXXXXXXXXX  X   X    ",
+"      XX  XX   X  XXXXXXXXXXX    ",
+"            XX   X XX   XX       ",
+"    XXXXXXX X XX X XX X X  XX    ",
+"    X     X XXXXX XXX   XXXX     ",
+"    X XXX X  X XX   XXXXX        ",
+"    X XXX X X XXXXXX XXX XXXX    ",
+"    X XXX X X  X    X   X  X     ",
+"    X     X    X  X     XXXX     ",
+"    XXXXXXX XXX X   X X X XXX    ",
+"                                 ",
+"                                 ",
+"                                 ",
+"                                 ",
 NULL
 	};
 	TEST_CHECK(test_encode(ctx, true, gs1_encoder_sQR, "^011234567890123110ABC123^11210630", expect));  // GS1 mode
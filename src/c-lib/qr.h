@@ -31,19 +31,51 @@
 #define MAX_QR_CWS		3706	// Maximum overall codewords (Version 40)
 #define MAX_QR_DAT_CWS_PER_BLK	128
 #define MAX_QR_ECC_CWS_PER_BLK	128
+#define MAX_QR_MODULES		29648	// Data and ECC modules, including remainder bits (Version 40)
 
 
+#include <stdint.h>
+
 #include "gs1encoders.h"
 
 
+/*
+ *  Modules packed into words, least significant bit first, for bitwise mask
+ *  evaluation. A row (or column) is QR_WORDS words, with trailing bits clear.
+ *
+ */
+#define QR_WORDS	((177 + 63) / 64)
+#define QR_MASK_PERIOD	12			// All mask patterns repeat every 12 modules
+
+
+/*
+ *  The parts of a symbol that depend only upon its version, built when a
+ *  version is first encoded and retained until another version is encoded
+ *
+ */
+struct qrLayout {
+	int version;					// Version held, or 0 for none
+	uint8_t img[MAX_QR_BYTES];			// Fixture patterns
+	uint8_t fix[MAX_QR_BYTES];			// Matrix in which 1 indicates fixed pattern
+	uint16_t place[MAX_QR_MODULES];			// Bit offset of each data module, in placement order
+	uint64_t freerows[MAX_QR_SIZE][QR_WORDS];	// Non-fixture modules, packed
+	uint64_t freecols[MAX_QR_SIZE][QR_WORDS];
+	uint64_t rowpats[8][QR_MASK_PERIOD][QR_WORDS];	// Mask patterns by position modulo period
+	uint64_t colpats[8][QR_MASK_PERIOD][QR_WORDS];
+};
+
+
 void gs1_QR(gs1_encoder *ctx);
 
 
 #ifdef UNIT_TESTS
 
 void test_qr_QR_fixtures(void);
+void test_qr_QR_segments(void);
+void test_qr_QR_rleWords(void);
 void test_qr_QR_versions(void);
 void test_qr_QR_encode(void);
+void test_qr_QR_maskStrategy(void);
 
 #endif
 
@@ -0,0 +1,241 @@
+/**
+ * GS1 Barcode Engine
+ *
+ * @author Copyright (c) 2021 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rs.h"
+
+
+// Prime polynomial and first generator root for each field
+static const struct {
+	uint16_t poly;
+	uint8_t root;
+} fields[] = {
+	[gs1_rsFieldQR] = { 0x11d, 0 },
+	[gs1_rsFieldDM] = { 0x12d, 1 },
+};
+
+
+// Product in GF(256); only used while preparing the code
+static inline uint8_t gfProd(const uint8_t *rslog, const uint8_t *rsalog, const uint8_t a, const uint8_t b) {
+
+	int s;
+
+	if (a == 0 || b == 0)
+		return 0;
+	s = rslog[a] + rslog[b];
+	return rsalog[s >= 255 ? s - 255 : s];
+
+}
+
+
+// Generate the coefficients of the generator polynomial for the given number
+// of ECC codewords and expand them into split-nibble product rows
+void gs1_rsInitCode(struct gs1_rsCode *rs, const enum gs1_rsField field, const int ecclen) {
+
+	uint8_t rslog[256] = { 0 };
+	uint8_t rsalog[256];
+	uint8_t coeffs[MAX_RS_ECC_CWS+1];
+	uint8_t c;
+	int i, j, v;
+
+	assert(field == gs1_rsFieldQR || field == gs1_rsFieldDM);
+	assert(ecclen >= 1 && ecclen <= MAX_RS_ECC_CWS);
+
+	// Log and anti-log tables for the field
+	for (i = 0, v = 1; i < 255; i++) {
+		rsalog[i] = (uint8_t)v;
+		rslog[v] = (uint8_t)i;
+		v <<= 1;
+		if (v & 0x100)
+			v ^= fields[field].poly;
+	}
+	rsalog[255] = 1;
+
+	// Product of (x - 2^k) over the ecclen consecutive roots
+	coeffs[0] = 1;
+	for (i = 0; i < ecclen; i++) {
+		c = rsalog[fields[field].root + i];
+		coeffs[i+1] = coeffs[i];
+		for (j = i; j > 0; j--)
+			coeffs[j] = (uint8_t)(coeffs[j-1] ^ gfProd(rslog, rsalog, coeffs[j], c));
+		coeffs[0] = gfProd(rslog, rsalog, coeffs[0], c);
+	}
+
+	// Rows are ordered from the highest-degree non-leading coefficient to
+	// match the shift direction of the encoder's register
+	memset(rs->lo, 0, sizeof(rs->lo));
+	memset(rs->hi, 0, sizeof(rs->hi));
+	rs->field = field;
+	rs->ecclen = ecclen;
+	rs->rowlen = (ecclen + RS_CHUNK - 1) / RS_CHUNK * RS_CHUNK;
+	for (i = 0; i < 16; i++) {
+		for (j = 0; j < ecclen; j++) {
+			c = coeffs[ecclen-j-1];
+			rs->lo[i][j] = gfProd(rslog, rsalog, c, (uint8_t)i);
+			rs->hi[i][j] = gfProd(rslog, rsalog, c, (uint8_t)(i << 4));
+		}
+	}
+
+}
+
+
+// Prepare the code unless it already holds the generator for the given field
+// and number of ECC codewords from an earlier symbol
+void gs1_rsPrepareCode(struct gs1_rsCode *rs, const enum gs1_rsField field, const int ecclen) {
+
+	if (rs->ecclen == ecclen && rs->field == field)
+		return;
+
+	gs1_rsInitCode(rs, field, ecclen);
+
+}
+
+
+// Perform Reed Solomon ECC codeword calculation using an LFSR whose feedback
+// product with every generator coefficient is the XOR of one row from each of
+// the nibble tables, so each step is a branch-free pass over the register.
+// Fixed-width chunks let the compiler emit vector XORs for the inner loop and
+// the zero padding beyond ecclen keeps the unused tail of the register clear.
+void gs1_rsEncode(const struct gs1_rsCode *rs, const uint8_t *datcws, const int datlen, uint8_t *ecccws) {
+
+	uint8_t reg[RS_ROW_LEN+1] = { 0 };	// Trailing zero shifts in
+	const uint8_t *lo, *hi;
+	uint8_t fb;
+	int i, j, k;
+
+	assert(rs->ecclen >= 1 && rs->ecclen <= MAX_RS_ECC_CWS);
+	assert(rs->rowlen % RS_CHUNK == 0 && rs->rowlen <= RS_ROW_LEN);
+
+	for (i = 0; i < datlen; i++) {
+		fb = (uint8_t)(datcws[i] ^ reg[0]);
+		lo = rs->lo[fb & 0x0f];
+		hi = rs->hi[fb >> 4];
+		for (j = 0; j < rs->rowlen; j += RS_CHUNK)
+			for (k = j; k < j + RS_CHUNK; k++)
+				reg[k] = (uint8_t)(reg[k+1] ^ lo[k] ^ hi[k]);
+	}
+
+	memcpy(ecccws, reg, (size_t)rs->ecclen);
+
+}
+
+
+#ifdef UNIT_TESTS
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+
+// Bitwise product in GF(256), independent of the encoder's tables
+static uint8_t test_gfMul(int a, int b, const int poly) {
+
+	int p = 0;
+
+	while (b) {
+		if (b & 1)
+			p ^= a;
+		b >>= 1;
+		a <<= 1;
+		if (a & 0x100)
+			a ^= poly;
+	}
+	return (uint8_t)p;
+
+}
+
+
+void test_rs_encode(void) {
+
+	struct gs1_rsCode rs;
+	uint8_t cws[200 + MAX_RS_ECC_CWS];
+	uint8_t ecc[MAX_RS_ECC_CWS];
+	uint8_t zero[MAX_RS_ECC_CWS] = { 0 };
+	int f, i, j, k, n, x, s;
+
+	// ISO/IEC 18004 Annex I: "01234567" as Version 1-M
+	static const uint8_t qrdat[] = {
+		0x10, 0x20, 0x0C, 0x56, 0x61, 0x80, 0xEC, 0x11,
+		0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11,
+	};
+	static const uint8_t qrecc[] = {
+		0xA5, 0x24, 0xD4, 0xC1, 0xED, 0x36, 0xC7, 0x87, 0x2C, 0x55,
+	};
+
+	// ISO/IEC 16022 Annex O: "123456" as 10x10
+	static const uint8_t dmdat[] = { 142, 164, 186 };
+	static const uint8_t dmecc[] = { 114, 25, 5, 88, 102 };
+
+	gs1_rsInitCode(&rs, gs1_rsFieldQR, sizeof(qrecc));
+	gs1_rsEncode(&rs, qrdat, sizeof(qrdat), ecc);
+	TEST_CHECK(memcmp(ecc, qrecc, sizeof(qrecc)) == 0);
+
+	gs1_rsInitCode(&rs, gs1_rsFieldDM, sizeof(dmecc));
+	gs1_rsEncode(&rs, dmdat, sizeof(dmdat), ecc);
+	TEST_CHECK(memcmp(ecc, dmecc, sizeof(dmecc)) == 0);
+
+	// A prepared code is kept for the same field and ecclen, otherwise rebuilt
+	rs.lo[1][0] ^= 0xff;
+	gs1_rsPrepareCode(&rs, gs1_rsFieldDM, sizeof(dmecc));
+	gs1_rsEncode(&rs, dmdat, sizeof(dmdat), ecc);
+	TEST_CHECK(memcmp(ecc, dmecc, sizeof(dmecc)) != 0);
+	gs1_rsPrepareCode(&rs, gs1_rsFieldQR, sizeof(dmecc));
+	gs1_rsPrepareCode(&rs, gs1_rsFieldDM, sizeof(dmecc));
+	gs1_rsEncode(&rs, dmdat, sizeof(dmdat), ecc);
+	TEST_CHECK(memcmp(ecc, dmecc, sizeof(dmecc)) == 0);
+	rs.lo[1][0] ^= 0xff;
+	gs1_rsPrepareCode(&rs, gs1_rsFieldDM, sizeof(qrecc));
+	gs1_rsPrepareCode(&rs, gs1_rsFieldDM, sizeof(dmecc));
+	gs1_rsEncode(&rs, dmdat, sizeof(dmdat), ecc);
+	TEST_CHECK(memcmp(ecc, dmecc, sizeof(dmecc)) == 0);
+
+	// Codewords of the all-zero message are zero for every block size
+	for (i = 1; i <= MAX_RS_ECC_CWS; i++) {
+		gs1_rsInitCode(&rs, gs1_rsFieldQR, i);
+		memset(ecc, 0xff, sizeof(ecc));
+		gs1_rsEncode(&rs, zero, MAX_RS_ECC_CWS, ecc);
+		TEST_CHECK(memcmp(ecc, zero, (size_t)i) == 0);
+	}
+
+	// Every codeword sequence vanishes at each root of the generator
+	for (f = gs1_rsFieldQR; f <= gs1_rsFieldDM; f++) {
+		for (n = 1; n <= MAX_RS_ECC_CWS; n++) {
+			for (i = 0; i < 200; i++)
+				cws[i] = (uint8_t)(i * 37 + n * 11 + f);
+			gs1_rsInitCode(&rs, (enum gs1_rsField)f, n);
+			gs1_rsEncode(&rs, cws, 200, cws + 200);
+			for (x = 1, k = 0; k < fields[f].root; k++)
+				x = test_gfMul(x, 2, fields[f].poly);
+			for (k = 0; k < n; k++) {
+				for (s = 0, j = 0; j < 200 + n; j++)
+					s = test_gfMul(s, x, fields[f].poly) ^ cws[j];
+				TEST_CHECK(s == 0);
+				TEST_MSG("Field %d, ecclen %d, root %d", f, n, k);
+				x = test_gfMul(x, 2, fields[f].poly);
+			}
+		}
+	}
+
+}
+
+
+#endif  /* UNIT_TESTS */
@@ -0,0 +1,69 @@
+/**
+ * GS1 Barcode Engine
+ *
+ * @author Copyright (c) 2021 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef RS_H
+#define RS_H
+
+#include <stdint.h>
+
+
+#define MAX_RS_ECC_CWS	68	// Largest ECC block of any symbology (Data Matrix 144x144)
+#define RS_CHUNK	16	// Register is processed in whole chunks of this width
+#define RS_ROW_LEN	((MAX_RS_ECC_CWS + RS_CHUNK - 1) / RS_CHUNK * RS_CHUNK)
+
+
+// Reed Solomon codes over GF(256) as used by the matrix symbologies
+enum gs1_rsField {
+	gs1_rsFieldQR = 0,	// x^8+x^4+x^3+x^2+1; generator roots 2^0..2^(n-1)
+	gs1_rsFieldDM,		// x^8+x^5+x^3+x^2+1; generator roots 2^1..2^n
+};
+
+
+/*
+ *  Generator polynomial for a given number of ECC codewords, held as
+ *  split-nibble product rows: lo[x][j] and hi[x][j] are the products of
+ *  generator coefficient j with x and x<<4, respectively, zero-padded to whole
+ *  chunks. Prepared once per symbol and then shared by all of its blocks, and
+ *  retained by the instance to be reused by later symbols with the same field
+ *  and number of ECC codewords. An ecclen of zero marks an unprepared code.
+ *
+ */
+struct gs1_rsCode {
+	enum gs1_rsField field;
+	int ecclen;
+	int rowlen;
+	uint8_t lo[16][RS_ROW_LEN];
+	uint8_t hi[16][RS_ROW_LEN];
+};
+
+
+void gs1_rsInitCode(struct gs1_rsCode *rs, enum gs1_rsField field, int ecclen);
+void gs1_rsPrepareCode(struct gs1_rsCode *rs, enum gs1_rsField field, int ecclen);
+void gs1_rsEncode(const struct gs1_rsCode *rs, const uint8_t *datcws, int datlen, uint8_t *ecccws);
+
+
+#ifdef UNIT_TESTS
+
+void test_rs_encode(void);
+
+#endif
+
+
+#endif  /* RS_H */
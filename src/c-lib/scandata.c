@@ -113,6 +113,9 @@ char* gs1_generateScanData(gs1_encoder* ctx) {
 
 	assert(ctx);
 
+	if ((ctx->outStr = gs1_scratch(ctx, ctx->outStr, 2*MAX_DATA+1)) == NULL)
+		return NULL;
+
 	*ctx->outStr = '\0';
 
 	if ((cc = strchr(ctx->dataStr, '|')) != NULL)		// Delimit end of linear data
@@ -270,10 +273,11 @@ bool gs1_processScanData(gs1_encoder* ctx, const char* scanData) {
 	ctx->numAIs = 0;
 
 	*ctx->errMsg = '\0';
+	ctx->errCode = gs1_encoder_eNONE;
 	ctx->errFlag = false;
 
 	if (*scanData != ']' || strlen(scanData) < 3) {
-		strcpy(ctx->errMsg, "Missing symbology identifier");
+		gs1_setError(ctx, gs1_encoder_eSCAN_MISSING_SYMBOLOGY_ID, NULL, 0, -1);
 		goto fail;
 	}
 
@@ -287,7 +291,7 @@ bool gs1_processScanData(gs1_encoder* ctx, const char* scanData) {
 	}
 
 	if (i == symIdTable_len) {
-		strcpy(ctx->errMsg, "Unsupported symbology identifier");
+		gs1_setError(ctx, gs1_encoder_eSCAN_UNSUPPORTED_SYMBOLOGY_ID, NULL, 0, -1);
 		goto fail;
 	}
 
@@ -300,7 +304,7 @@ bool gs1_processScanData(gs1_encoder* ctx, const char* scanData) {
 		primaryLen = (sym == gs1_encoder_sEAN13) ? 13 : 8;
 
 		if (strlen(scanData) < primaryLen) {
-			strcpy(ctx->errMsg, "Primary scan data is too short");
+			gs1_setError(ctx, gs1_encoder_eSCAN_PRIMARY_TOO_SHORT, NULL, 0, -1);
 			goto fail;
 		}
 
@@ -308,7 +312,7 @@ bool gs1_processScanData(gs1_encoder* ctx, const char* scanData) {
 		    strncmp(scanData + primaryLen, "|]e0", 4) == 0) {
 			cc = scanData + primaryLen + 4;
 		} else if (strlen(scanData) > primaryLen) {
-			strcpy(ctx->errMsg, "Primary message is too short");
+			gs1_setError(ctx, gs1_encoder_eSCAN_PRIMARY_TOO_LONG, NULL, 0, -1);
 			goto fail;
 		}
 
@@ -316,12 +320,12 @@ bool gs1_processScanData(gs1_encoder* ctx, const char* scanData) {
 		strncat(p, scanData, primaryLen);
 
 		if (!gs1_allDigits((uint8_t*)p, 0)) {
-			strcpy(ctx->errMsg, "Primary message number only contain digits");
+			gs1_setError(ctx, gs1_encoder_eSCAN_PRIMARY_NON_DIGIT, NULL, 0, -1);
 			goto fail;
 		}
 
 		if (!gs1_validateParity((uint8_t*)p)) {
-			strcpy(ctx->errMsg, "Primary message check digit is incorrect");
+			gs1_setError(ctx, gs1_encoder_eSCAN_PRIMARY_CHECK_DIGIT, NULL, 0, -1);
 			goto fail;
 		}
 
@@ -343,7 +347,7 @@ bool gs1_processScanData(gs1_encoder* ctx, const char* scanData) {
 
 		// Forbid data "^" characters at this stage so we don't conflate with FNC1
 		if (strchr(scanData, '^') != NULL) {
-			strcpy(ctx->errMsg, "Scan data contains illegal ^ character");
+			gs1_setError(ctx, gs1_encoder_eSCAN_ILLEGAL_CARET, NULL, 0, -1);
 			goto fail;
 		}
 
@@ -356,6 +360,9 @@ bool gs1_processScanData(gs1_encoder* ctx, const char* scanData) {
 		if (!gs1_processAIdata(ctx, q, true))	// Validate AI data and extract AIs
 			goto fail;
 
+		if (ctx->validateAIassociations && !gs1_validateAIassociations(ctx))
+			goto fail;
+
 		return true;
 
 	}
@@ -374,8 +381,12 @@ bool gs1_processScanData(gs1_encoder* ctx, const char* scanData) {
 	if ((strlen(ctx->dataStr) >= 8 && strncmp(ctx->dataStr, "https://", 8) == 0) || // Digital Link URI
 	    (strlen(ctx->dataStr) >= 7 && strncmp(ctx->dataStr, "http://",  7) == 0)) {
 		// We extract AIs with the element string stored in dlAIbuffer
+		if ((ctx->dlAIbuffer = gs1_scratch(ctx, ctx->dlAIbuffer, MAX_DATA+1)) == NULL)
+			goto fail;
 		if (!gs1_parseDLuri(ctx, ctx->dataStr, ctx->dlAIbuffer))
 			goto fail;
+		if (ctx->validateAIassociations && !gs1_validateAIassociations(ctx))
+			goto fail;
 	}
 
 	return true;
@@ -515,7 +526,7 @@ static void do_test_testProcessScanData(gs1_encoder *ctx, const bool should_succ
 	TEST_CASE(casename);
 
 	TEST_CHECK(gs1_processScanData(ctx, scanData) ^ !should_succeed);
-	TEST_MSG("Error message: %s", ctx->errMsg);
+	TEST_MSG("Error message: %s", gs1_encoder_getErrMsg(ctx));
 	TEST_CHECK(ctx->sym == expectSym);
 	TEST_MSG("Got: %d; Expected: %d (%s)", ctx->sym, expectSym, expectSymName);
 	TEST_CHECK(strcmp(ctx->dataStr, expectDataStr) == 0);
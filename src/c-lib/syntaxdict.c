@@ -0,0 +1,396 @@
+/**
+ * GS1 Barcode Engine
+ *
+ * @author Copyright (c) 2021 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * A compiled syntax dictionary is read from its file and its AI table and AI
+ * association rules are used in place of the built-in tables, so that new AIs
+ * can be rolled out without rebuilding the library. The file has the in-memory layout, so loading it is
+ * a single read with no parsing.
+ *
+ * Since lookups and validation trust the table, every field is checked once
+ * when it is loaded. The table is then used from a private copy rather than a
+ * mapping of the file, so that the file can later be rewritten or replaced
+ * while the library is running without affecting the checked table.
+ *
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "enc-private.h"
+#include "gs1encoders.h"
+#include "ai.h"
+#include "syntaxdict.h"
+
+
+static bool isDigit(const char c) {
+	return c >= '0' && c <= '9';
+}
+
+
+static bool isAI(const char *ai) {
+	size_t len = strnlen(ai, 5);
+	return len >= 2 && len <= 4 && isDigit(ai[0]) && isDigit(ai[1]) &&
+	       (len < 3 || isDigit(ai[2])) && (len < 4 || isDigit(ai[3]));
+}
+
+
+/*
+ *  Check that the association rules are sorted, that each AI that is referred
+ *  to by a rule has a distinct bit and that the rules refer to no other bits
+ *
+ */
+static bool checkSyntaxDictAssocs(const struct aiAssoc *assocs, const size_t numAssocs) {
+
+	const struct aiAssoc *assoc;
+	uint32_t assigned = 0, used = 0;
+	size_t i, j;
+
+	for (i = 0; i < numAssocs; i++) {
+		assoc = &assocs[i];
+		if (!isAI(assoc->ai) || (i > 0 && strcmp(assocs[i-1].ai, assoc->ai) >= 0))
+			return false;
+		if (assoc->bit != NO_ASSOC_BIT) {
+			if (assoc->bit >= 32 || (assigned & (uint32_t)1 << assoc->bit))
+				return false;
+			assigned |= (uint32_t)1 << assoc->bit;
+		}
+		used |= assoc->ex;
+		for (j = 0; j < MAX_ASSOC_REQS; j++)
+			used |= assoc->req[j];
+	}
+
+	return (used & ~assigned) == 0;
+
+}
+
+
+/*
+ *  Check that the file contents are a complete dictionary whose entries are
+ *  sorted, correctly indexed and within the limits assumed by the AI code
+ *
+ */
+static bool checkSyntaxDict(const uint8_t *map, const size_t size) {
+
+	const struct syntaxDictHeader *hdr = (const struct syntaxDictHeader *)map;
+	const struct aiEntry *table, *entry;
+	const struct aiComponent *part;
+	size_t i, j, len, minLen, maxLen, assocOffset;
+	int key;
+	bool ended;
+
+	if (size < sizeof(struct syntaxDictHeader) ||
+	    memcmp(hdr->magic, SYNTAX_DICT_MAGIC, sizeof(hdr->magic)) != 0 ||
+	    hdr->version != SYNTAX_DICT_VERSION ||
+	    hdr->byteOrder != SYNTAX_DICT_BYTE_ORDER ||
+	    hdr->entrySize != sizeof(struct aiEntry) ||
+	    hdr->assocSize != sizeof(struct aiAssoc))
+		return false;
+
+	// The association rules follow the AI table, suitably aligned
+	assocOffset = sizeof(struct syntaxDictHeader) + (size_t)hdr->numEntries * sizeof(struct aiEntry);
+	if (assocOffset % sizeof(uint32_t) != 0 ||
+	    size != assocOffset + (size_t)hdr->numAssocs * sizeof(struct aiAssoc))
+		return false;
+	if (!checkSyntaxDictAssocs((const struct aiAssoc *)(map + assocOffset), hdr->numAssocs))
+		return false;
+
+	if (hdr->index[0] != 0 || hdr->index[AI_INDEX_KEYS] != hdr->numEntries)
+		return false;
+	for (key = 0; key < AI_INDEX_KEYS; key++)
+		if (hdr->index[key] > hdr->index[key+1])
+			return false;
+
+	table = (const struct aiEntry *)(map + sizeof(struct syntaxDictHeader));
+	for (i = 0; i < hdr->numEntries; i++) {
+		entry = &table[i];
+
+		// AIs are two to four digits, in sorted order
+		if (!isAI(entry->ai))
+			return false;
+		len = strlen(entry->ai);
+		if (i > 0 && strcmp(table[i-1].ai, entry->ai) >= 0)
+			return false;
+
+		// Indexed in the group for the first three digits
+		key = (entry->ai[0] - '0') * 100 + (entry->ai[1] - '0') * 10 + (len > 2 ? entry->ai[2] - '0' : 0);
+		if (i < hdr->index[key] || i >= hdr->index[key+1])
+			return false;
+
+		if (entry->fnc1 > 1 || entry->dlPkey > 1 ||
+		    strnlen(entry->title, sizeof(entry->title)) == sizeof(entry->title))
+			return false;
+
+		// Components are contiguous and sum to the value lengths
+		minLen = maxLen = 0;
+		ended = false;
+		for (j = 0; j < SIZEOF_ARRAY(entry->parts); j++) {
+			part = &entry->parts[j];
+			if (part->cset == cset_none) {
+				ended = true;
+			} else if (ended || part->cset > cset_C || part->min > part->max)
+				return false;
+			if (part->linters[0] >= NUM_LINTERS)
+				return false;
+			minLen += part->min;
+			maxLen += part->max;
+		}
+		if (entry->parts[0].cset == cset_none || entry->minLen != minLen ||
+		    entry->maxLen != maxLen || maxLen > MAX_AI_LEN)
+			return false;
+	}
+
+	return true;
+
+}
+
+
+bool gs1_loadSyntaxDict(gs1_encoder *ctx, const char *file) {
+
+	const struct syntaxDictHeader *hdr;
+	FILE *fp;
+	long len;
+	uint8_t *dict = NULL;
+	size_t size = 0;
+
+	assert(ctx);
+	assert(file);
+
+#ifdef NOMALLOC
+	sprintf(ctx->errMsg, "Syntax dictionaries are not supported by this build: %s", file);
+	ctx->errFlag = true;
+	return false;
+#endif
+
+	if ((fp = fopen(file, "rb")) == NULL) {
+		sprintf(ctx->errMsg, "Unable to open syntax dictionary: %s", file);
+		ctx->errFlag = true;
+		return false;
+	}
+
+	// Read the whole file into a private copy; a length that cannot be a
+	// dictionary is left for the checks to reject
+	if (fseek(fp, 0, SEEK_END) == 0 && (len = ftell(fp)) > 0 &&
+	    (unsigned long)len <= MAX_SYNTAX_DICT_SIZE && fseek(fp, 0, SEEK_SET) == 0) {
+		if ((dict = malloc((size_t)len)) == NULL) {
+			fclose(fp);
+			sprintf(ctx->errMsg, "Out of memory loading syntax dictionary: %s", file);
+			ctx->errFlag = true;
+			return false;
+		}
+		size = fread(dict, 1, (size_t)len, fp);
+		if (fgetc(fp) != EOF)		// Grown since its length was taken
+			size = 0;
+	}
+	fclose(fp);
+
+	if (!dict || !checkSyntaxDict(dict, size)) {
+		free(dict);
+		sprintf(ctx->errMsg, "Invalid syntax dictionary: %s", file);
+		ctx->errFlag = true;
+		return false;
+	}
+
+	hdr = (const struct syntaxDictHeader *)dict;
+	gs1_freeSyntaxDict(ctx);
+	ctx->syntaxDict = dict;
+	ctx->aiTable = (const struct aiEntry *)(dict + sizeof(struct syntaxDictHeader));
+	ctx->aiIndex = hdr->index;
+	ctx->aiTableSize = hdr->numEntries;
+	ctx->aiAssoc = (const struct aiAssoc *)(ctx->aiTable + hdr->numEntries);
+	ctx->aiAssocSize = hdr->numAssocs;
+
+	return true;
+
+}
+
+
+// Release any loaded dictionary and revert to the built-in AI table
+void gs1_freeSyntaxDict(gs1_encoder *ctx) {
+
+	assert(ctx);
+
+	free(ctx->syntaxDict);
+	ctx->syntaxDict = NULL;
+	gs1_setBuiltinAItable(ctx);
+
+}
+
+
+#ifdef UNIT_TESTS
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+
+// Write the tables currently in use as a compiled syntax dictionary
+static bool writeSyntaxDict(gs1_encoder *ctx, const char *file, const struct aiEntry *table, const struct aiAssoc *assocs) {
+
+	struct syntaxDictHeader hdr;
+	FILE *fp;
+	bool ret;
+
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, SYNTAX_DICT_MAGIC, sizeof(hdr.magic));
+	hdr.version = SYNTAX_DICT_VERSION;
+	hdr.byteOrder = SYNTAX_DICT_BYTE_ORDER;
+	hdr.entrySize = sizeof(struct aiEntry);
+	hdr.numEntries = ctx->aiTableSize;
+	hdr.assocSize = sizeof(struct aiAssoc);
+	hdr.numAssocs = ctx->aiAssocSize;
+	memcpy(hdr.index, ctx->aiIndex, sizeof(hdr.index));
+
+	if ((fp = fopen(file, "wb")) == NULL)
+		return false;
+	ret = fwrite(&hdr, sizeof(hdr), 1, fp) == 1 &&
+	      fwrite(table, sizeof(struct aiEntry), ctx->aiTableSize, fp) == ctx->aiTableSize &&
+	      fwrite(assocs, sizeof(struct aiAssoc), ctx->aiAssocSize, fp) == ctx->aiAssocSize;
+	fclose(fp);
+
+	return ret;
+
+}
+
+
+void test_syntaxdict_load(void) {
+
+	gs1_encoder* ctx;
+	static struct aiEntry table[1024];
+	static struct aiEntry loaded[1024];
+	static struct aiAssoc assocs[1024];
+	const struct aiEntry *builtin, *entry, *current;
+	const struct aiAssoc *builtinAssoc;
+	size_t i, j, n, na;
+	FILE *fp;
+	static const char *fname = "gs1encoders-test.dict";
+	static const char *fchanged = "gs1encoders-test-changed.dict";
+	static const char *fbadlen = "gs1encoders-test-badlen.dict";
+	static const char *fbadlint = "gs1encoders-test-badlint.dict";
+	static const char *funsorted = "gs1encoders-test-unsorted.dict";
+	static const char *fbadassoc = "gs1encoders-test-badassoc.dict";
+
+	TEST_ASSERT((ctx = gs1_encoder_init(NULL)) != NULL);
+	TEST_ASSERT(gs1_encoder_setValidateAIassociations(ctx, true));
+	builtin = ctx->aiTable;
+	n = ctx->aiTableSize;
+	TEST_ASSERT(n <= SIZEOF_ARRAY(table));
+	memcpy(table, builtin, n * sizeof(struct aiEntry));
+	builtinAssoc = ctx->aiAssoc;
+	na = ctx->aiAssocSize;
+	TEST_ASSERT(na <= SIZEOF_ARRAY(assocs));
+	memcpy(assocs, builtinAssoc, na * sizeof(struct aiAssoc));
+
+	TEST_CHECK(strcmp(gs1_encoder_getSyntaxDictionary(ctx), "") == 0);
+	TEST_CHECK(!gs1_encoder_setSyntaxDictionary(ctx, "gs1encoders-test-nonexistent.dict"));
+
+#ifdef NOMALLOC
+	TEST_CHECK(strncmp(gs1_encoder_getErrMsg(ctx), "Syntax dictionaries are not supported", 37) == 0);
+	gs1_encoder_free(ctx);
+	return;
+#endif
+
+	TEST_CHECK(strncmp(gs1_encoder_getErrMsg(ctx), "Unable to open syntax dictionary", 32) == 0);
+
+	// An identical dictionary gives identical results from the copy
+	TEST_ASSERT(writeSyntaxDict(ctx, fname, table, assocs));
+	TEST_ASSERT(gs1_encoder_setSyntaxDictionary(ctx, fname));
+	TEST_CHECK(strcmp(gs1_encoder_getSyntaxDictionary(ctx), fname) == 0);
+	TEST_CHECK(ctx->aiTable != builtin);
+	for (i = 0; i < n; i++) {
+		entry = gs1_lookupAIentry(ctx, builtin[i].ai, strlen(builtin[i].ai));
+		TEST_CHECK(entry == &ctx->aiTable[i]);
+		TEST_CHECK(memcmp(entry, &builtin[i], sizeof(struct aiEntry)) == 0);
+	}
+	TEST_CHECK(ctx->aiAssoc != builtinAssoc);
+	TEST_CHECK(ctx->aiAssocSize == na);
+	TEST_CHECK(memcmp(ctx->aiAssoc, builtinAssoc, na * sizeof(struct aiAssoc)) == 0);
+	TEST_CHECK(gs1_encoder_setAIdataStr(ctx, "(01)12312312312333(10)ABCDEF(8013)1987654Ad4X4bL5ttr2310c2K"));
+	TEST_CHECK(!gs1_encoder_setAIdataStr(ctx, "(10)ABCDEF"));	// Requires a GTIN
+
+	// Changes to the dictionary take effect without rebuilding
+	for (i = 0; strcmp(table[i].ai, "10") != 0; i++);
+	table[i].parts[0].max = 5;
+	table[i].maxLen = 5;
+	for (j = 0; strcmp(assocs[j].ai, "10") != 0; j++);
+	assocs[j].req[0] = 0;
+	TEST_ASSERT(writeSyntaxDict(ctx, fchanged, table, assocs));
+	TEST_ASSERT(gs1_encoder_setSyntaxDictionary(ctx, fchanged));
+	TEST_CHECK(!gs1_encoder_setAIdataStr(ctx, "(01)12312312312333(10)ABCDEF"));
+	TEST_CHECK(gs1_encoder_setAIdataStr(ctx, "(01)12312312312333(10)ABCDE"));
+	TEST_CHECK(gs1_encoder_setAIdataStr(ctx, "(10)ABCDE"));
+	current = ctx->aiTable;
+	memcpy(loaded, current, n * sizeof(struct aiEntry));
+
+	// Rewriting the file in use does not disturb the loaded table
+	TEST_ASSERT((fp = fopen(fchanged, "wb")) != NULL);
+	fclose(fp);
+	TEST_CHECK(!gs1_encoder_setAIdataStr(ctx, "(01)12312312312333(10)ABCDEF"));
+	TEST_CHECK(gs1_encoder_setAIdataStr(ctx, "(01)12312312312333(10)ABCDE"));
+
+	// Inconsistent dictionaries are rejected and the current one is retained
+	table[i].maxLen = 6;
+	TEST_ASSERT(writeSyntaxDict(ctx, fbadlen, table, assocs));
+	TEST_CHECK(!gs1_encoder_setSyntaxDictionary(ctx, fbadlen));
+	TEST_CHECK(strncmp(gs1_encoder_getErrMsg(ctx), "Invalid syntax dictionary", 25) == 0);
+	table[i].maxLen = 5;
+	table[i].parts[0].linters[0] = NUM_LINTERS;
+	TEST_ASSERT(writeSyntaxDict(ctx, fbadlint, table, assocs));
+	TEST_CHECK(!gs1_encoder_setSyntaxDictionary(ctx, fbadlint));
+	table[i].parts[0].linters[0] = linter_none;
+	memcpy(&table[i], &table[i+1], sizeof(struct aiEntry));	// Unsorted
+	TEST_ASSERT(writeSyntaxDict(ctx, funsorted, table, assocs));
+	TEST_CHECK(!gs1_encoder_setSyntaxDictionary(ctx, funsorted));
+	memcpy(&table[i], &builtin[i], sizeof(struct aiEntry));
+	table[i].parts[0].max = 5;
+	table[i].maxLen = 5;
+	assocs[j].req[0] = (uint32_t)1 << 31;				// Unassigned bit
+	TEST_ASSERT(writeSyntaxDict(ctx, fbadassoc, table, assocs));
+	TEST_CHECK(!gs1_encoder_setSyntaxDictionary(ctx, fbadassoc));
+	TEST_CHECK(!gs1_encoder_setSyntaxDictionary(ctx, fchanged));	// Now empty
+	TEST_CHECK(strcmp(gs1_encoder_getSyntaxDictionary(ctx), fchanged) == 0);
+	TEST_CHECK(ctx->aiTable == current);
+	TEST_CHECK(memcmp(ctx->aiTable, loaded, n * sizeof(struct aiEntry)) == 0);
+	TEST_CHECK(!gs1_encoder_setAIdataStr(ctx, "(01)12312312312333(10)ABCDEF"));
+	TEST_CHECK(gs1_encoder_setAIdataStr(ctx, "(10)ABCDE"));
+
+	remove(fname);
+	remove(fchanged);
+	remove(fbadlen);
+	remove(fbadlint);
+	remove(funsorted);
+	remove(fbadassoc);
+
+	// Revert to the built-in table
+	TEST_CHECK(gs1_encoder_setSyntaxDictionary(ctx, ""));
+	TEST_CHECK(ctx->aiTable == builtin);
+	TEST_CHECK(ctx->aiAssoc == builtinAssoc);
+	TEST_CHECK(gs1_encoder_setAIdataStr(ctx, "(01)12312312312333(10)ABCDEF"));
+	TEST_CHECK(!gs1_encoder_setAIdataStr(ctx, "(10)ABCDEF"));
+
+	gs1_encoder_free(ctx);
+
+}
+
+
+#endif  /* UNIT_TESTS */
@@ -0,0 +1,68 @@
+/**
+ * GS1 Barcode Engine
+ *
+ * @author Copyright (c) 2021 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef SYNTAXDICT_H
+#define SYNTAXDICT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "gs1encoders.h"
+#include "ai.h"
+
+
+#define SYNTAX_DICT_MAGIC	"GS1D"
+#define SYNTAX_DICT_VERSION	2
+#define SYNTAX_DICT_BYTE_ORDER	0x0102
+#define MAX_SYNTAX_DICT_SIZE	(sizeof(struct syntaxDictHeader) + UINT16_MAX * (sizeof(struct aiEntry) + sizeof(struct aiAssoc)))
+
+
+/*
+ *  A compiled syntax dictionary file consists of this header followed
+ *  immediately by the AI table entries, in the same layout as struct aiEntry,
+ *  and then by the AI association rules, in the same layout as struct
+ *  aiAssoc. It is written by "build-gs1-syntax-dict.pl --binary".
+ *
+ */
+struct syntaxDictHeader {
+	char magic[4];
+	uint16_t version;
+	uint16_t byteOrder;			// Reads differently on a platform of the other byte order
+	uint16_t entrySize;
+	uint16_t numEntries;
+	uint16_t assocSize;
+	uint16_t numAssocs;
+	uint16_t index[AI_INDEX_KEYS+1];	// First entry of each group of AIs
+	uint16_t pad;				// Aligns the association rules
+};
+
+
+bool gs1_loadSyntaxDict(gs1_encoder *ctx, const char *file);
+void gs1_freeSyntaxDict(gs1_encoder *ctx);
+
+
+#ifdef UNIT_TESTS
+
+void test_syntaxdict_load(void);
+
+#endif
+
+
+#endif  /* SYNTAXDICT_H */